@@ -15,7 +15,9 @@ public class GAS : ModuleRules
 			"SlateCore",
 			"GameplayAbilities",
 			"GameplayTags",
-			"GameplayTasks"
+			"GameplayTasks",
+			"NetCore",
+			"ReplicationGraph"
 			 });
 
 		// Uncomment if you are using Slate UI
@@ -6,9 +6,12 @@
 #include "AbilitySystemGlobals.h"
 #include "Animation/AnimInstance.h"
 #include "Characters/Abilities/GASAbilitySystemComponent.h"
+#include "Characters/Abilities/GASAnimNotify_GameplayEvent.h"
 #include "Characters/Abilities/GASGameplayAbility.h"
 #include "Gas/Gas.h"
 #include "GameFramework/Character.h"
+#include "GASMontageCacheSubsystem.h"
+#include "TimerManager.h"
 
 UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -38,6 +41,12 @@ void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::OnMontageBlendingOut(
 
 	if (bInterrupted)
 	{
+		// Notifies don't fire after an interruption either
+		if (Montage == MontageToPlay)
+		{
+			ClearScheduledMontageEvents();
+		}
+
 		if (ShouldBroadcastAbilityTaskDelegates())
 		{
 			OnInterrupted.Broadcast(FGameplayTag(), FGameplayEventData());
@@ -147,6 +156,11 @@ void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::Activate()
 					Character->SetAnimRootMotionTranslationScale(AnimRootMotionTranslationScale);
 				}
 
+				if (UGASAnimNotify_GameplayEvent::UseServerMontageEvents(this))
+				{
+					ScheduleMontageEvents();
+				}
+
 				bPlayedMontage = true;
 			}
 		}
@@ -197,6 +211,8 @@ void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::OnDestroy(bool Abilit
 		}
 	}
 
+	ClearScheduledMontageEvents();
+
 	if (AbilitySystemComponent.IsValid())
 	{
 		AbilitySystemComponent->RemoveGameplayEventTagContainerDelegate(EventTags, EventHandle);
@@ -206,6 +222,93 @@ void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::OnDestroy(bool Abilit
 
 }
 
+void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::ScheduleMontageEvents()
+{
+	UGASMontageCacheSubsystem* MontageCache = GetWorld()->GetSubsystem<UGASMontageCacheSubsystem>();
+	if (!MontageCache)
+	{
+		return;
+	}
+
+	const TArray<FGASMontageGameplayEvent>& MontageEvents = MontageCache->GetMontageEvents(MontageToPlay);
+	const float PlayRate = Rate * MontageToPlay->RateScale;
+	if (MontageEvents.Num() == 0 || PlayRate <= 0.f)
+	{
+		return;
+	}
+
+	// Montage time the montage starts playing from. Events are scheduled linearly from here, section jumps and loops aren't followed.
+	const int32 StartSectionIndex = StartSection != NAME_None ? MontageToPlay->GetSectionIndex(StartSection) : INDEX_NONE;
+	const float StartTime = StartSectionIndex != INDEX_NONE ? MontageToPlay->GetAnimCompositeSection(StartSectionIndex).GetTime() : 0.f;
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	for (const FGASMontageGameplayEvent& MontageEvent : MontageEvents)
+	{
+		if (MontageEvent.Time < StartTime)
+		{
+			continue;
+		}
+
+		const float Delay = (MontageEvent.Time - StartTime) / PlayRate;
+		FTimerDelegate EventDelegate = FTimerDelegate::CreateUObject(this, &UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::FireScheduledMontageEvent, MontageEvent.EventTag);
+
+		FTimerHandle& TimerHandle = ScheduledEventTimers.AddDefaulted_GetRef();
+		if (Delay > 0.f)
+		{
+			TimerManager.SetTimer(TimerHandle, EventDelegate, Delay, false);
+		}
+		else
+		{
+			TimerHandle = TimerManager.SetTimerForNextTick(EventDelegate);
+		}
+	}
+
+	UGASAbilitySystemComponent* ASC = Cast<UGASAbilitySystemComponent>(AbilitySystemComponent.Get());
+	if (ASC)
+	{
+		ASC->SetScheduledEventsMontage(MontageToPlay);
+	}
+}
+
+void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::ClearScheduledMontageEvents()
+{
+	if (ScheduledEventTimers.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (World)
+	{
+		for (FTimerHandle& TimerHandle : ScheduledEventTimers)
+		{
+			World->GetTimerManager().ClearTimer(TimerHandle);
+		}
+	}
+
+	ScheduledEventTimers.Reset();
+
+	UGASAbilitySystemComponent* ASC = Cast<UGASAbilitySystemComponent>(AbilitySystemComponent.Get());
+	if (ASC && ASC->IsMontageEventScheduled(MontageToPlay))
+	{
+		ASC->SetScheduledEventsMontage(nullptr);
+	}
+}
+
+void UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::FireScheduledMontageEvent(FGameplayTag EventTag)
+{
+	if (!AbilitySystemComponent.IsValid())
+	{
+		return;
+	}
+
+	// Same as UGASAnimNotify_GameplayEvent would send, so other listeners get it too
+	FGameplayEventData Payload;
+	Payload.EventTag = EventTag;
+	Payload.Instigator = GetAvatarActor();
+	AbilitySystemComponent->HandleGameplayEvent(EventTag, &Payload);
+}
+
 bool UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::StopPlayingMontage()
 {
 	const FGameplayAbilityActorInfo* ActorInfo = Ability->GetCurrentActorInfo();
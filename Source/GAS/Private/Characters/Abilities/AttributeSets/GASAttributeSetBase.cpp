@@ -2,19 +2,88 @@
 
 
 #include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
+#include "Characters/Abilities/AttributeSets/GASAttributeSetEconomy.h"
+#include "Characters/Abilities/GASGE_Bounty.h"
 #include "Characters/GASCharacterMain.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectExtension.h"
 #include "Net/UnrealNetwork.h"
 #include "..\..\..\..\Public\Player\GASPlayerController.h"
 
+namespace GASAttributeRules
+{
+	int32 AggregateDamage = 0;
+	static FAutoConsoleVariableRef CVarAggregateDamage(
+		TEXT("GAS.AggregateDamage"),
+		AggregateDamage,
+		TEXT("When non-zero, hit reacts, damage numbers and bounties from all damage a character takes in one frame are merged into a single event. Health is still applied per hit."),
+		ECVF_Default);
+
+	enum class EGASAttributeExecuteRoute : uint8
+	{
+		None,
+		// Meta attribute, turned into -Health by HandleDamage()
+		Damage,
+		// Clamp to [0, MaxAttribute] after a GE executes on it
+		ClampToMax
+	};
+
+	typedef FGameplayAttribute(*FGASAttributeGetter)();
+
+	// How an attribute behaves when it changes. One row per attribute that needs special handling, attributes without a row have no extra behavior.
+	struct FGASAttributeRule
+	{
+		FGASAttributeGetter Attribute;
+
+		// PreAttributeChange: this is a max attribute, scale the affected attribute to keep its current % of the max
+		FGASAttributeGetter AdjustOnMaxChange;
+
+		// PreAttributeChange: clamp the new current value
+		bool bClampValue;
+		float ClampMin;
+		float ClampMax;
+
+		// PostGameplayEffectExecute
+		EGASAttributeExecuteRoute ExecuteRoute;
+		FGASAttributeGetter MaxAttribute;
+	};
+
+	const FGASAttributeRule AttributeRules[] =
+	{
+		// Attribute, AdjustOnMaxChange, bClampValue, ClampMin, ClampMax, ExecuteRoute, MaxAttribute
+		{ &UGASAttributeSetBase::GetHealthAttribute, nullptr, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::ClampToMax, &UGASAttributeSetBase::GetMaxHealthAttribute },
+		{ &UGASAttributeSetBase::GetMaxHealthAttribute, &UGASAttributeSetBase::GetHealthAttribute, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::None, nullptr },
+		{ &UGASAttributeSetBase::GetManaAttribute, nullptr, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::ClampToMax, &UGASAttributeSetBase::GetMaxManaAttribute },
+		{ &UGASAttributeSetBase::GetMaxManaAttribute, &UGASAttributeSetBase::GetManaAttribute, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::None, nullptr },
+		{ &UGASAttributeSetBase::GetStaminaAttribute, nullptr, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::ClampToMax, &UGASAttributeSetBase::GetMaxStaminaAttribute },
+		{ &UGASAttributeSetBase::GetMaxStaminaAttribute, &UGASAttributeSetBase::GetStaminaAttribute, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::None, nullptr },
+		// Cannot slow less than 150 units/s and cannot boost more than 1000 units/s
+		{ &UGASAttributeSetBase::GetMoveSpeedAttribute, nullptr, true, 150.0f, 1000.0f, EGASAttributeExecuteRoute::None, nullptr },
+		{ &UGASAttributeSetBase::GetDamageAttribute, nullptr, false, 0.0f, 0.0f, EGASAttributeExecuteRoute::Damage, nullptr },
+	};
+
+	// Single lookup from the attribute's property to its rule. Built the first time an attribute changes.
+	const FGASAttributeRule* FindAttributeRule(const FGameplayAttribute& Attribute)
+	{
+		static const TMap<const FProperty*, const FGASAttributeRule*> RulesByProperty = []()
+		{
+			TMap<const FProperty*, const FGASAttributeRule*> Map;
+			for (const FGASAttributeRule& Rule : AttributeRules)
+			{
+				Map.Add(Rule.Attribute().GetUProperty(), &Rule);
+			}
+			return Map;
+		}();
+
+		const FGASAttributeRule* const* Rule = RulesByProperty.Find(Attribute.GetUProperty());
+		return Rule ? *Rule : nullptr;
+	}
+}
+
 UGASAttributeSetBase::UGASAttributeSetBase()
 {
-	// Cache tags
-	HitDirectionFrontTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Front"));
-	HitDirectionBackTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Back"));
-	HitDirectionRightTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Right"));
-	HitDirectionLeftTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Left"));
+	bPendingHitLocationValid = false;
+	bPendingDamageFlushScheduled = false;
 }
 
 void UGASAttributeSetBase::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -22,23 +91,22 @@ void UGASAttributeSetBase::PreAttributeChange(const FGameplayAttribute& Attribut
 	// This is called whenever attributes change, so for max health/mana we want to scale the current totals to match
 	Super::PreAttributeChange(Attribute, NewValue);
 
-	// If a Max value changes, adjust current to keep Current % of Current to Max
-	if (Attribute == GetMaxHealthAttribute()) // GetMaxHealthAttribute comes from the Macros defined at the top of the header
+	const GASAttributeRules::FGASAttributeRule* Rule = GASAttributeRules::FindAttributeRule(Attribute);
+	if (!Rule)
 	{
-		AdjustAttributeForMaxChange(Health, MaxHealth, NewValue, GetHealthAttribute());
+		return;
 	}
-	else if (Attribute == GetMaxManaAttribute())
-	{
-		AdjustAttributeForMaxChange(Mana, MaxMana, NewValue, GetManaAttribute());
-	}
-	else if (Attribute == GetMaxStaminaAttribute())
+
+	// If a Max value changes, adjust current to keep Current % of Current to Max
+	if (Rule->AdjustOnMaxChange)
 	{
-		AdjustAttributeForMaxChange(Stamina, MaxStamina, NewValue, GetStaminaAttribute());
+		const FGameplayAttribute AffectedAttribute = Rule->AdjustOnMaxChange();
+		AdjustAttributeForMaxChange(*AffectedAttribute.GetGameplayAttributeData(this), *Attribute.GetGameplayAttributeData(this), NewValue, AffectedAttribute);
 	}
-	else if (Attribute == GetMoveSpeedAttribute())
+
+	if (Rule->bClampValue)
 	{
-		// Cannot slow less than 150 units/s and cannot boost more than 1000 units/s
-		NewValue = FMath::Clamp<float>(NewValue, 150, 1000);
+		NewValue = FMath::Clamp<float>(NewValue, Rule->ClampMin, Rule->ClampMax);
 	}
 }
 
@@ -46,6 +114,32 @@ void UGASAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCal
 {
 	Super::PostGameplayEffectExecute(Data);
 
+	const GASAttributeRules::FGASAttributeRule* Rule = GASAttributeRules::FindAttributeRule(Data.EvaluatedData.Attribute);
+	if (!Rule)
+	{
+		return;
+	}
+
+	switch (Rule->ExecuteRoute)
+	{
+	case GASAttributeRules::EGASAttributeExecuteRoute::Damage:
+		HandleDamage(Data);
+		break;
+	case GASAttributeRules::EGASAttributeExecuteRoute::ClampToMax:
+	{
+		// Health/Mana/Stamina changes that didn't go through a meta attribute. Health loss should go through Damage.
+		const FGameplayAttribute& Attribute = Data.EvaluatedData.Attribute;
+		const float MaxValue = Rule->MaxAttribute ? Rule->MaxAttribute().GetNumericValue(this) : Attribute.GetNumericValue(this);
+		GetOwningAbilitySystemComponent()->SetNumericAttributeBase(Attribute, FMath::Clamp(Attribute.GetNumericValue(this), 0.0f, MaxValue));
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void UGASAttributeSetBase::HandleDamage(const FGameplayEffectModCallbackData& Data)
+{
 	FGameplayEffectContextHandle Context = Data.EffectSpec.GetContext();
 	UAbilitySystemComponent* Source = Context.GetOriginalInstigatorAbilitySystemComponent();
 	const FGameplayTagContainer& SourceTags = *Data.EffectSpec.CapturedSourceTags.GetAggregatedTags();
@@ -96,149 +190,192 @@ void UGASAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCal
 		}
 	}
 
-	if (Data.EvaluatedData.Attribute == GetDamageAttribute())
+	// Try to extract a hit result
+	FHitResult HitResult;
+	if (Context.GetHitResult())
 	{
-		// Try to extract a hit result
-		FHitResult HitResult;
-		if (Context.GetHitResult())
+		HitResult = *Context.GetHitResult();
+	}
+
+	// Store a local copy of the amount of damage done and clear the damage attribute
+	const float LocalDamageDone = GetDamage();
+	SetDamage(0.f);
+
+	if (LocalDamageDone > 0.0f)
+	{
+		// If character was alive before damage is added, handle damage
+		// This prevents damage being added to dead things and replaying death animations
+		bool WasAlive = true;
+
+		if (TargetCharacter)
 		{
-			HitResult = *Context.GetHitResult();
+			WasAlive = TargetCharacter->IsAlive();
 		}
 
-		// Store a local copy of the amount of damage done and clear the damage attribute
-		const float LocalDamageDone = GetDamage();
-		SetDamage(0.f);
-	
-		if (LocalDamageDone > 0.0f)
+		if (!TargetCharacter->IsAlive())
 		{
-			// If character was alive before damage is added, handle damage
-			// This prevents damage being added to dead things and replaying death animations
-			bool WasAlive = true;
+			//UE_LOG(LogTemp, Warning, TEXT("%s() %s is NOT alive when receiving damage"), TEXT(__FUNCTION__), *TargetCharacter->GetName());
+		}
 
-			if (TargetCharacter)
-			{
-				WasAlive = TargetCharacter->IsAlive();
-			}
+		// Apply the health change and then clamp it
+		const float NewHealth = GetHealth() - LocalDamageDone;
+		SetHealth(FMath::Clamp(NewHealth, 0.0f, GetMaxHealth()));
 
-			if (!TargetCharacter->IsAlive())
+		if (TargetCharacter && WasAlive)
+		{
+			// This is the log statement for damage received. Turned off for live games.
+			//UE_LOG(LogTemp, Log, TEXT("%s() %s Damage Received: %f"), TEXT(__FUNCTION__), *GetOwningActor()->GetName(), LocalDamageDone);
+
+			if (GASAttributeRules::AggregateDamage)
 			{
-				//UE_LOG(LogTemp, Warning, TEXT("%s() %s is NOT alive when receiving damage"), TEXT(__FUNCTION__), *TargetCharacter->GetName());
+				// Health was applied above, everything else is merged into one event for this frame
+				QueuePendingDamage(LocalDamageDone, Data.EffectSpec.GetContext().GetHitResult(), Source, SourceActor, SourceController, SourceCharacter, TargetActor, TargetController, TargetCharacter);
+				return;
 			}
 
-			// Apply the health change and then clamp it
-			const float NewHealth = GetHealth() - LocalDamageDone;
-			SetHealth(FMath::Clamp(NewHealth, 0.0f, GetMaxHealth()));
+			// Play HitReact animation and sound. Replicated to clients through AGASCharacterMain::HitReact.
+			const FHitResult* Hit = Data.EffectSpec.GetContext().GetHitResult();
+			PlayHitReactOnTarget(TargetCharacter, Hit ? &Hit->Location : nullptr, SourceCharacter);
 
-			if (TargetCharacter && WasAlive)
+			// Show damage number for the Source player unless it was self damage
+			if (SourceActor != TargetActor)
 			{
-				// This is the log statement for damage received. Turned off for live games.
-				//UE_LOG(LogTemp, Log, TEXT("%s() %s Damage Received: %f"), TEXT(__FUNCTION__), *GetOwningActor()->GetName(), LocalDamageDone);
-
-				// Play HitReact animation and sound with a multicast RPC.
-				const FHitResult* Hit = Data.EffectSpec.GetContext().GetHitResult();
-
-				if (Hit)
-				{
-					EGASHitReactDirection HitDirection = TargetCharacter->GetHitReactDirection(Data.EffectSpec.GetContext().GetHitResult()->Location);
-					switch (HitDirection)
-					{
-					case EGASHitReactDirection::Left:
-						TargetCharacter->PlayHitReact(HitDirectionLeftTag, SourceCharacter);
-						break;
-					case EGASHitReactDirection::Front:
-						TargetCharacter->PlayHitReact(HitDirectionFrontTag, SourceCharacter);
-						break;
-					case EGASHitReactDirection::Right:
-						TargetCharacter->PlayHitReact(HitDirectionRightTag, SourceCharacter);
-						break;
-					case EGASHitReactDirection::Back:
-						TargetCharacter->PlayHitReact(HitDirectionBackTag, SourceCharacter);
-						break;
-					}
-				}
-				else
+				AGASPlayerController* PC = Cast<AGASPlayerController>(SourceController);
+				if (PC)
 				{
-					// No hit result. Default to front.
-					TargetCharacter->PlayHitReact(HitDirectionFrontTag, SourceCharacter);
-				}
-
-				// Show damage number for the Source player unless it was self damage
-				if (SourceActor != TargetActor)
-				{
-					AGASPlayerController* PC = Cast<AGASPlayerController>(SourceController);
-					if (PC)
-					{
-						PC->ShowDamageNumber(LocalDamageDone, TargetCharacter);
-					}
+					PC->QueueDamageNumber(LocalDamageDone, TargetCharacter);
 				}
+			}
 
-				if (!TargetCharacter->IsAlive())
+			if (!TargetCharacter->IsAlive())
+			{
+				// TargetCharacter was alive before this damage and now is not alive, give XP and Gold bounties to Source.
+				// Don't give bounty to self.
+				if (SourceController != TargetController)
 				{
-					// TargetCharacter was alive before this damage and now is not alive, give XP and Gold bounties to Source.
-					// Don't give bounty to self.
-					if (SourceController != TargetController)
-					{
-						// Create a dynamic instant Gameplay Effect to give the bounties
-						UGameplayEffect* GEBounty = NewObject<UGameplayEffect>(GetTransientPackage(), FName(TEXT("Bounty")));
-						GEBounty->DurationPolicy = EGameplayEffectDurationType::Instant;
-
-						int32 Idx = GEBounty->Modifiers.Num();
-						GEBounty->Modifiers.SetNum(Idx + 2);
-
-						FGameplayModifierInfo& InfoXP = GEBounty->Modifiers[Idx];
-						InfoXP.ModifierMagnitude = FScalableFloat(GetXPBounty());
-						InfoXP.ModifierOp = EGameplayModOp::Additive;
-						InfoXP.Attribute = UGASAttributeSetBase::GetXPAttribute();
-
-						FGameplayModifierInfo& InfoGold = GEBounty->Modifiers[Idx + 1];
-						InfoGold.ModifierMagnitude = FScalableFloat(GetGoldBounty());
-						InfoGold.ModifierOp = EGameplayModOp::Additive;
-						InfoGold.Attribute = UGASAttributeSetBase::GetGoldAttribute();
-
-						Source->ApplyGameplayEffectToSelf(GEBounty, 1.0f, Source->MakeEffectContext());
-					}
+					GiveBounty(Source, TargetCharacter);
 				}
 			}
 		}
-	}// Damage
-	else if (Data.EvaluatedData.Attribute == GetHealthAttribute())
+	}
+}
+
+void UGASAttributeSetBase::PlayHitReactOnTarget(AGASCharacterMain* TargetCharacter, const FVector* HitLocation, AGASCharacterMain* SourceCharacter)
+{
+	// No hit result. Default to front.
+	const EGASHitReactDirection HitDirection = HitLocation ? TargetCharacter->GetHitReactDirection(*HitLocation) : EGASHitReactDirection::Front;
+	TargetCharacter->PlayHitReact(HitDirection, SourceCharacter);
+}
+
+void UGASAttributeSetBase::GiveBounty(UAbilitySystemComponent* Source, AGASCharacterMain* TargetCharacter)
+{
+	// Only sources with an economy set (Heroes) can receive bounties
+	if (!Source || !TargetCharacter || !Source->GetSet<UGASAttributeSetEconomy>())
+	{
+		return;
+	}
+
+	// The bounty effect is shared, the amounts are passed as SetByCaller magnitudes
+	FGameplayEffectSpec BountySpec(GetDefault<UGASGE_Bounty>(), Source->MakeEffectContext(), 1.0f);
+	BountySpec.SetSetByCallerMagnitude(UGASGE_Bounty::XPDataName, TargetCharacter->GetXPBounty());
+	BountySpec.SetSetByCallerMagnitude(UGASGE_Bounty::GoldDataName, TargetCharacter->GetGoldBounty());
+
+	Source->ApplyGameplayEffectSpecToSelf(BountySpec);
+}
+
+void UGASAttributeSetBase::QueuePendingDamage(float DamageDone, const FHitResult* Hit, UAbilitySystemComponent* Source, AActor* SourceActor, AController* SourceController, AGASCharacterMain* SourceCharacter,
+	AActor* TargetActor, AController* TargetController, AGASCharacterMain* TargetCharacter)
+{
+	// The last hit of the frame decides the hit react direction and causer
+	PendingHitReactCauser = SourceCharacter;
+	bPendingHitLocationValid = Hit != nullptr;
+	if (Hit)
 	{
-		// Handle other health changes.
-		// Health loss should go through Damage.
-		SetHealth(FMath::Clamp(GetHealth(), 0.0f, GetMaxHealth()));
-	} // Health
-	else if (Data.EvaluatedData.Attribute == GetManaAttribute())
+		PendingHitLocation = Hit->Location;
+	}
+
+	// Show damage numbers for the Source player unless it was self damage. One number per source player per frame.
+	AGASPlayerController* PC = Cast<AGASPlayerController>(SourceController);
+	if (PC && SourceActor != TargetActor)
+	{
+		FGASPendingDamage* Pending = PendingDamage.FindByPredicate([PC](const FGASPendingDamage& Entry) { return Entry.SourcePlayerController.Get() == PC; });
+		if (!Pending)
+		{
+			Pending = &PendingDamage.AddDefaulted_GetRef();
+			Pending->SourcePlayerController = PC;
+		}
+
+		Pending->Damage += DamageDone;
+	}
+
+	// This hit killed the target. Don't give bounty to self.
+	if (!TargetCharacter->IsAlive() && SourceController != TargetController)
 	{
-		// Handle mana changes.
-		SetMana(FMath::Clamp(GetMana(), 0.0f, GetMaxMana()));
-	} // Mana
-	else if (Data.EvaluatedData.Attribute == GetStaminaAttribute())
+		PendingKiller = Source;
+	}
+
+	if (!bPendingDamageFlushScheduled)
 	{
-		// Handle stamina changes.
-		SetStamina(FMath::Clamp(GetStamina(), 0.0f, GetMaxStamina()));
+		UWorld* World = GetWorld();
+		if (World)
+		{
+			bPendingDamageFlushScheduled = true;
+			World->GetTimerManager().SetTimerForNextTick(this, &UGASAttributeSetBase::FlushPendingDamage);
+		}
 	}
 }
 
+void UGASAttributeSetBase::FlushPendingDamage()
+{
+	bPendingDamageFlushScheduled = false;
+
+	AGASCharacterMain* TargetCharacter = GetActorInfo() ? Cast<AGASCharacterMain>(GetActorInfo()->AvatarActor.Get()) : nullptr;
+	if (TargetCharacter)
+	{
+		PlayHitReactOnTarget(TargetCharacter, bPendingHitLocationValid ? &PendingHitLocation : nullptr, PendingHitReactCauser.Get());
+
+		for (const FGASPendingDamage& Pending : PendingDamage)
+		{
+			if (Pending.SourcePlayerController.IsValid())
+			{
+				Pending.SourcePlayerController->QueueDamageNumber(Pending.Damage, TargetCharacter);
+			}
+		}
+
+		if (PendingKiller.IsValid())
+		{
+			GiveBounty(PendingKiller.Get(), TargetCharacter);
+		}
+	}
+
+	PendingDamage.Reset();
+	PendingHitReactCauser.Reset();
+	PendingKiller.Reset();
+	bPendingHitLocationValid = false;
+}
+
 void UGASAttributeSetBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, HealthRegenRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, Mana, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, MaxMana, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, ManaRegenRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, Stamina, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, MaxStamina, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, StaminaRegenRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, Armor, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, MoveSpeed, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, CharacterLevel, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, XP, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, XPBounty, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, Gold, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGASAttributeSetBase, GoldBounty, COND_None, REPNOTIFY_Always);
+	// Push model: attributes are only compared and sent after MarkAttributeDirty() flags them
+	FDoRepLifetimeParams Params;
+	Params.Condition = COND_None;
+	Params.RepNotifyCondition = REPNOTIFY_Always;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, Health, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, MaxHealth, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, HealthRegenRate, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, Mana, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, MaxMana, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, ManaRegenRate, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, Stamina, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, MaxStamina, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, StaminaRegenRate, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, Armor, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, MoveSpeed, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetBase, CharacterLevel, Params);
 }
 
 void UGASAttributeSetBase::AdjustAttributeForMaxChange(FGameplayAttributeData & AffectedAttribute, const FGameplayAttributeData & MaxAttribute, float NewMaxValue, const FGameplayAttribute & AffectedAttributeProperty)
@@ -255,47 +392,47 @@ void UGASAttributeSetBase::AdjustAttributeForMaxChange(FGameplayAttributeData &
 	}
 }
 
-void UGASAttributeSetBase::OnRep_Health(const FGameplayAttributeData& OldHealth)
+void UGASAttributeSetBase::OnRep_Health(const FGASVitalAttributeData& OldHealth)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, Health, OldHealth);
 }
 
-void UGASAttributeSetBase::OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth)
+void UGASAttributeSetBase::OnRep_MaxHealth(const FGASVitalAttributeData& OldMaxHealth)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, MaxHealth, OldMaxHealth);
 }
 
-void UGASAttributeSetBase::OnRep_HealthRegenRate(const FGameplayAttributeData& OldHealthRegenRate)
+void UGASAttributeSetBase::OnRep_HealthRegenRate(const FGASRateAttributeData& OldHealthRegenRate)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, HealthRegenRate, OldHealthRegenRate);
 }
 
-void UGASAttributeSetBase::OnRep_Mana(const FGameplayAttributeData& OldMana)
+void UGASAttributeSetBase::OnRep_Mana(const FGASVitalAttributeData& OldMana)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, Mana, OldMana);
 }
 
-void UGASAttributeSetBase::OnRep_MaxMana(const FGameplayAttributeData& OldMaxMana)
+void UGASAttributeSetBase::OnRep_MaxMana(const FGASVitalAttributeData& OldMaxMana)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, MaxMana, OldMaxMana);
 }
 
-void UGASAttributeSetBase::OnRep_ManaRegenRate(const FGameplayAttributeData& OldManaRegenRate)
+void UGASAttributeSetBase::OnRep_ManaRegenRate(const FGASRateAttributeData& OldManaRegenRate)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, ManaRegenRate, OldManaRegenRate);
 }
 
-void UGASAttributeSetBase::OnRep_Stamina(const FGameplayAttributeData& OldStamina)
+void UGASAttributeSetBase::OnRep_Stamina(const FGASVitalAttributeData& OldStamina)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, Stamina, OldStamina);
 }
 
-void UGASAttributeSetBase::OnRep_MaxStamina(const FGameplayAttributeData& OldMaxStamina)
+void UGASAttributeSetBase::OnRep_MaxStamina(const FGASVitalAttributeData& OldMaxStamina)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, MaxStamina, OldMaxStamina);
 }
 
-void UGASAttributeSetBase::OnRep_StaminaRegenRate(const FGameplayAttributeData& OldStaminaRegenRate)
+void UGASAttributeSetBase::OnRep_StaminaRegenRate(const FGASRateAttributeData& OldStaminaRegenRate)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, StaminaRegenRate, OldStaminaRegenRate);
 }
@@ -314,23 +451,3 @@ void UGASAttributeSetBase::OnRep_CharacterLevel(const FGameplayAttributeData& Ol
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, CharacterLevel, OldCharacterLevel);
 }
-
-void UGASAttributeSetBase::OnRep_XP(const FGameplayAttributeData& OldXP)
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, XP, OldXP);
-}
-
-void UGASAttributeSetBase::OnRep_XPBounty(const FGameplayAttributeData& OldXPBounty)
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, XPBounty, OldXPBounty);
-}
-
-void UGASAttributeSetBase::OnRep_Gold(const FGameplayAttributeData& OldGold)
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, Gold, OldGold);
-}
-
-void UGASAttributeSetBase::OnRep_GoldBounty(const FGameplayAttributeData& OldGoldBounty)
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetBase, GoldBounty, OldGoldBounty);
-}
@@ -0,0 +1,33 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/AttributeSets/GASAttributeSetEconomy.h"
+#include "Net/UnrealNetwork.h"
+
+UGASAttributeSetEconomy::UGASAttributeSetEconomy()
+{
+}
+
+void UGASAttributeSetEconomy::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Only the owning player's HUD reads XP and Gold
+	FDoRepLifetimeParams Params;
+	Params.Condition = COND_OwnerOnly;
+	Params.RepNotifyCondition = REPNOTIFY_Always;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetEconomy, XP, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGASAttributeSetEconomy, Gold, Params);
+}
+
+void UGASAttributeSetEconomy::OnRep_XP(const FGameplayAttributeData& OldXP)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetEconomy, XP, OldXP);
+}
+
+void UGASAttributeSetEconomy::OnRep_Gold(const FGameplayAttributeData& OldGold)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UGASAttributeSetEconomy, Gold, OldGold);
+}
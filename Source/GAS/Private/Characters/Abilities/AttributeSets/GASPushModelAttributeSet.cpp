@@ -0,0 +1,35 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/AttributeSets/GASPushModelAttributeSet.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+void UGASPushModelAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+	}
+}
+
+void UGASPushModelAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// The base value replicates too, so it needs to be sent even if modifiers keep the current value the same
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+	}
+}
+
+void UGASPushModelAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute) const
+{
+	FProperty* Property = Attribute.GetUProperty();
+	if (Property && Property->HasAnyPropertyFlags(CPF_Net))
+	{
+		MARK_PROPERTY_DIRTY(this, Property);
+	}
+}
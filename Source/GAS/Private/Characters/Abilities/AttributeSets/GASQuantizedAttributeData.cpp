@@ -0,0 +1,101 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/AttributeSets/GASQuantizedAttributeData.h"
+#include "GAS.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Quantized Attribute Bits Sent"), STAT_GASQuantizedAttributeBits, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Quantized Attribute Bits Unquantized"), STAT_GASQuantizedAttributeBitsUnquantized, STATGROUP_GAS);
+
+namespace GASQuantizedAttributeData
+{
+	// Writes/reads one value as a 1 bit "quantized" flag followed by either the step index or the raw float.
+	// Returns the number of bits used.
+	uint32 SerializeValue(FArchive& Ar, float& Value, float MinValue, float Step, uint32 NumSteps)
+	{
+		uint8 bQuantized = 0;
+		uint32 Index = 0;
+
+		if (Ar.IsSaving())
+		{
+			int64 RoundedIndex = FMath::RoundToInt64((Value - MinValue) / Step);
+
+			// Never send a nonzero value as exactly 0, e.g. a sliver of Health must not read as dead on clients.
+			// Sub step values round away from 0 to the nearest step instead.
+			const int64 ZeroIndex = FMath::RoundToInt64(-MinValue / Step);
+			if (RoundedIndex == ZeroIndex && Value != 0.0f)
+			{
+				RoundedIndex += Value > 0.0f ? 1 : -1;
+			}
+
+			bQuantized = (FMath::IsFinite(Value) && RoundedIndex >= 0 && RoundedIndex < NumSteps) ? 1 : 0;
+			Index = bQuantized ? static_cast<uint32>(RoundedIndex) : 0;
+		}
+
+		Ar.SerializeBits(&bQuantized, 1);
+
+		if (bQuantized)
+		{
+			Ar.SerializeInt(Index, NumSteps);
+
+			if (Ar.IsLoading())
+			{
+				// Exact 0 for the zero step, MinValue + Index * Step can be off by float error
+				Value = Index == FMath::RoundToInt64(-MinValue / Step) ? 0.0f : MinValue + Index * Step;
+			}
+
+			return 1 + FMath::CeilLogTwo(NumSteps);
+		}
+
+		Ar << Value;
+		return 1 + sizeof(float) * 8;
+	}
+
+	bool SerializeAttributeData(FArchive& Ar, FGameplayAttributeData& Data, float MinValue, float Step, uint32 NumSteps)
+	{
+		float BaseValue = Data.GetBaseValue();
+		float CurrentValue = Data.GetCurrentValue();
+
+		// Most of the time nothing modifies these attributes so Current == Base and we only send one value
+		uint8 bCurrentEqualsBase = (BaseValue == CurrentValue) ? 1 : 0;
+		Ar.SerializeBits(&bCurrentEqualsBase, 1);
+
+		uint32 NumBits = 1 + SerializeValue(Ar, BaseValue, MinValue, Step, NumSteps);
+
+		if (bCurrentEqualsBase)
+		{
+			CurrentValue = BaseValue;
+		}
+		else
+		{
+			NumBits += SerializeValue(Ar, CurrentValue, MinValue, Step, NumSteps);
+		}
+
+		if (Ar.IsLoading())
+		{
+			Data.SetBaseValue(BaseValue);
+			Data.SetCurrentValue(CurrentValue);
+		}
+		else
+		{
+			INC_DWORD_STAT_BY(STAT_GASQuantizedAttributeBits, NumBits);
+			INC_DWORD_STAT_BY(STAT_GASQuantizedAttributeBitsUnquantized, 2 * sizeof(float) * 8);
+		}
+
+		return !Ar.IsError();
+	}
+}
+
+bool FGASVitalAttributeData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// [0, 100000] in 0.1 steps, 20 bits per value
+	bOutSuccess = GASQuantizedAttributeData::SerializeAttributeData(Ar, *this, 0.0f, 0.1f, 1000001);
+	return true;
+}
+
+bool FGASRateAttributeData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// [-500, 500] in 0.01 steps, 17 bits per value
+	bOutSuccess = GASQuantizedAttributeData::SerializeAttributeData(Ar, *this, -500.0f, 0.01f, 100001);
+	return true;
+}
@@ -2,8 +2,132 @@
 
 
 #include "Characters/Abilities/GASAbilitySystemComponent.h"
+#include "Characters/Abilities/GASGameplayAbility.h"
+#include "GameplayEffectAggregator.h"
+#include "GAS.h"
+
+DECLARE_CYCLE_STAT(TEXT("GAS Apply Effect Specs Batch"), STAT_GASApplyEffectSpecsBatch, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Batched Ability Activations"), STAT_GASBatchedAbilityActivations, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Ability Server RPCs"), STAT_GASAbilityServerRPCs, STATGROUP_GAS);
+
+bool UGASAbilitySystemComponent::ShouldDoServerAbilityRPCBatch() const
+{
+	return bBatchAbilityRPCs;
+}
+
+void UGASAbilitySystemComponent::AbilityLocalInputPressed(int32 InputID)
+{
+	// Generic confirm/cancel, active abilities and abilities that don't batch are handled by the engine
+	if (ShouldDoServerAbilityRPCBatch() && !IsGenericConfirmInputBound(InputID) && !IsGenericCancelInputBound(InputID))
+	{
+		ABILITYLIST_SCOPE_LOCK();
+		for (FGameplayAbilitySpec& Spec : ActivatableAbilities.Items)
+		{
+			const UGASGameplayAbility* GASAbility = Cast<UGASGameplayAbility>(Spec.Ability);
+			if (Spec.InputID == InputID && GASAbility && GASAbility->bBatchRPCs && !Spec.IsActive())
+			{
+				Spec.InputPressed = true;
+				BatchRPCTryActivateAbility(Spec.Handle, GASAbility->bEndAbilityInRPCBatch);
+				return;
+			}
+		}
+	}
+
+	Super::AbilityLocalInputPressed(InputID);
+}
+
+bool UGASAbilitySystemComponent::BatchRPCTryActivateAbility(FGameplayAbilitySpecHandle AbilityHandle, bool bEndAbilityImmediately)
+{
+	if (!AbilityHandle.IsValid())
+	{
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_GASBatchedAbilityActivations);
+
+	// Everything the ability sends to the Server until the end of this scope is sent as one ServerAbilityRPCBatch
+	FScopedServerAbilityRPCBatcher AbilityRPCBatcher(this, AbilityHandle);
+
+	const bool bActivated = TryActivateAbility(AbilityHandle, true);
+
+	if (bActivated && bEndAbilityImmediately)
+	{
+		FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(AbilityHandle);
+		UGASGameplayAbility* GASAbility = AbilitySpec ? Cast<UGASGameplayAbility>(AbilitySpec->GetPrimaryInstance()) : nullptr;
+		if (GASAbility)
+		{
+			GASAbility->ExternalEndAbility();
+		}
+	}
+
+	return bActivated;
+}
+
+void UGASAbilitySystemComponent::CallServerTryActivateAbility(FGameplayAbilitySpecHandle AbilityToActivate, bool InputPressed, FPredictionKey PredictionKey)
+{
+	if (!IsServerAbilityRPCBatched(AbilityToActivate))
+	{
+		INC_DWORD_STAT(STAT_GASAbilityServerRPCs);
+	}
+
+	Super::CallServerTryActivateAbility(AbilityToActivate, InputPressed, PredictionKey);
+}
+
+void UGASAbilitySystemComponent::CallServerEndAbility(FGameplayAbilitySpecHandle AbilityToEnd, FGameplayAbilityActivationInfo ActivationInfo, FPredictionKey PredictionKey)
+{
+	if (!IsServerAbilityRPCBatched(AbilityToEnd))
+	{
+		INC_DWORD_STAT(STAT_GASAbilityServerRPCs);
+	}
+
+	Super::CallServerEndAbility(AbilityToEnd, ActivationInfo, PredictionKey);
+}
+
+void UGASAbilitySystemComponent::EndServerAbilityRPCBatch(FGameplayAbilitySpecHandle AbilityHandle)
+{
+	// Sent as one ServerAbilityRPCBatch
+	INC_DWORD_STAT(STAT_GASAbilityServerRPCs);
+
+	Super::EndServerAbilityRPCBatch(AbilityHandle);
+}
+
+bool UGASAbilitySystemComponent::IsServerAbilityRPCBatched(FGameplayAbilitySpecHandle AbilityHandle) const
+{
+	return LocalServerAbilityRPCBatchData.FindByKey(AbilityHandle) != nullptr;
+}
 
 void UGASAbilitySystemComponent::ReceiveDamage(UGASAbilitySystemComponent * SourceASC, float UnmitigatedDamage, float MitigatedDamage)
 {
 	ReceivedDamage.Broadcast(SourceASC, UnmitigatedDamage, MitigatedDamage);
 }
+
+TArray<FActiveGameplayEffectHandle> UGASAbilitySystemComponent::ApplyGameplayEffectSpecsToSelf(const TArray<FGameplayEffectSpecHandle>& Specs)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASApplyEffectSpecsBatch);
+
+	TArray<FActiveGameplayEffectHandle> ActiveHandles;
+	ActiveHandles.Reserve(Specs.Num());
+
+	// Defers FAggregator::OnDirty until the end of the scope, dirty aggregators are only evaluated and broadcast once
+	FScopedAggregatorOnDirtyBatch AggregatorBatch;
+
+	for (const FGameplayEffectSpecHandle& Spec : Specs)
+	{
+		if (Spec.IsValid())
+		{
+			ActiveHandles.Add(ApplyGameplayEffectSpecToSelf(*Spec.Data.Get()));
+		}
+	}
+
+	return ActiveHandles;
+}
+
+void UGASAbilitySystemComponent::SetScheduledEventsMontage(const UAnimMontage* Montage)
+{
+	ScheduledEventsMontage = Montage;
+}
+
+bool UGASAbilitySystemComponent::IsMontageEventScheduled(const UAnimMontage* Montage) const
+{
+	return Montage && ScheduledEventsMontage.Get() == Montage;
+}
@@ -0,0 +1,74 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/GASAnimNotify_GameplayEvent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemGlobals.h"
+#include "Animation/AnimMontage.h"
+#include "Characters/Abilities/GASAbilitySystemComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+namespace GASMontageEvents
+{
+	int32 ServerMontageEvents = 1;
+	static FAutoConsoleVariableRef CVarServerMontageEvents(
+		TEXT("GAS.ServerMontageEvents"),
+		ServerMontageEvents,
+		TEXT("When non-zero, dedicated servers fire montage gameplay events from precomputed notify times instead of anim notifies and heroes skip bone refresh."),
+		ECVF_Default);
+}
+
+void UGASAnimNotify_GameplayEvent::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	AActor* Owner = MeshComp ? MeshComp->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	// Already fired (or about to be) by the montage task's timers
+	UGASAbilitySystemComponent* ASC = Cast<UGASAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Owner));
+	if (ASC && ASC->IsMontageEventScheduled(Cast<UAnimMontage>(Animation)))
+	{
+		return;
+	}
+
+	FGameplayEventData Payload;
+	Payload.EventTag = EventTag;
+	Payload.Instigator = Owner;
+	UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(Owner, EventTag, Payload);
+}
+
+FString UGASAnimNotify_GameplayEvent::GetNotifyName_Implementation() const
+{
+	return EventTag.IsValid() ? EventTag.ToString() : Super::GetNotifyName_Implementation();
+}
+
+bool UGASAnimNotify_GameplayEvent::UseServerMontageEvents(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return GASMontageEvents::ServerMontageEvents != 0 && World && World->GetNetMode() == NM_DedicatedServer;
+}
+
+void UGASAnimNotify_GameplayEvent::GatherMontageEvents(const UAnimMontage* Montage, TArray<FGASMontageGameplayEvent>& OutEvents)
+{
+	OutEvents.Reset();
+	if (!Montage)
+	{
+		return;
+	}
+
+	for (const FAnimNotifyEvent& NotifyEvent : Montage->Notifies)
+	{
+		const UGASAnimNotify_GameplayEvent* EventNotify = Cast<UGASAnimNotify_GameplayEvent>(NotifyEvent.Notify);
+		if (EventNotify && EventNotify->EventTag.IsValid())
+		{
+			OutEvents.Add({ NotifyEvent.GetTriggerTime(), EventNotify->EventTag });
+		}
+	}
+
+	OutEvents.Sort([](const FGASMontageGameplayEvent& A, const FGASMontageGameplayEvent& B) { return A.Time < B.Time; });
+}
@@ -0,0 +1,76 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/GASAttributeInitData.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+
+bool UGASAttributeInitData::ApplyToAbilitySystem(UAbilitySystemComponent* AbilitySystemComponent, int32 Level) const
+{
+	AActor* Owner = AbilitySystemComponent ? AbilitySystemComponent->GetOwner() : nullptr;
+	if (!Owner || !Owner->HasAuthority() || Attributes.Num() == 0)
+	{
+		return false;
+	}
+
+	for (const FGASAttributeInitValue& Value : Attributes)
+	{
+		if (!Value.Attribute.IsValid() || Value.LevelValues.Num() == 0 || !AbilitySystemComponent->HasAttributeSetForAttribute(Value.Attribute))
+		{
+			continue;
+		}
+
+		const int32 LevelIndex = FMath::Clamp(Level - 1, 0, Value.LevelValues.Num() - 1);
+		AbilitySystemComponent->SetNumericAttributeBase(Value.Attribute, Value.LevelValues[LevelIndex]);
+	}
+
+	// The attribute sets are push based and were marked dirty above, send them all together
+	Owner->ForceNetUpdate();
+
+	return true;
+}
+
+#if WITH_EDITOR
+void UGASAttributeInitData::BakeFromSourceEffect()
+{
+	const UGameplayEffect* Effect = SourceEffect ? SourceEffect.GetDefaultObject() : nullptr;
+	if (!Effect)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s() %s has no SourceEffect to bake from."), *FString(__FUNCTION__), *GetName());
+		return;
+	}
+
+	Modify();
+	Attributes.Reset();
+
+	for (const FGameplayModifierInfo& Modifier : Effect->Modifiers)
+	{
+		if (Modifier.ModifierOp != EGameplayModOp::Override)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s() Skipping %s in %s, only Override modifiers can be baked."), *FString(__FUNCTION__), *Modifier.Attribute.GetName(), *Effect->GetName());
+			continue;
+		}
+
+		FGASAttributeInitValue Value;
+		Value.Attribute = Modifier.Attribute;
+
+		for (int32 Level = 1; Level <= MaxLevel; Level++)
+		{
+			float Magnitude = 0.0f;
+			if (!Modifier.ModifierMagnitude.GetStaticMagnitudeIfPossible(Level, Magnitude))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s() Skipping %s in %s, its magnitude isn't static."), *FString(__FUNCTION__), *Modifier.Attribute.GetName(), *Effect->GetName());
+				Value.LevelValues.Reset();
+				break;
+			}
+
+			Value.LevelValues.Add(Magnitude);
+		}
+
+		if (Value.LevelValues.Num() > 0)
+		{
+			Attributes.Add(Value);
+		}
+	}
+}
+#endif
@@ -4,6 +4,7 @@
 #include "..\..\..\Public\Characters\Abilities\GASDamageExecCalculation.h"
 #include "Characters/Abilities/GASAbilitySystemComponent.h"
 #include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
+#include "GASGameplayTags.h"
 
 // Declare the attributes to capture and define how we want to capture them from the Source and Target.
 struct GDDamageStatics
@@ -63,7 +64,7 @@ void UGASDamageExecCalculation::Execute_Implementation(const FGameplayEffectCust
 	// Capture optional damage value set on the damage GE as a CalculationModifier under the ExecutionCalculation
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().DamageDef, EvaluationParameters, Damage);
 	// Add SetByCaller damage if it exists
-	Damage += FMath::Max<float>(Spec.GetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(FName("Data.Damage")), false, -1.0f), 0.0f);
+	Damage += FMath::Max<float>(Spec.GetSetByCallerMagnitude(FGASGameplayTags::Get().Data_Damage, false, -1.0f), 0.0f);
 
 	float UnmitigatedDamage = Damage; // Can multiply any damage boosters here
 	
@@ -0,0 +1,29 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/GASGE_Bounty.h"
+#include "Characters/Abilities/AttributeSets/GASAttributeSetEconomy.h"
+
+const FName UGASGE_Bounty::XPDataName(TEXT("XP"));
+const FName UGASGE_Bounty::GoldDataName(TEXT("Gold"));
+
+UGASGE_Bounty::UGASGE_Bounty()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat XPSetByCaller;
+	XPSetByCaller.DataName = XPDataName;
+
+	FGameplayModifierInfo& InfoXP = Modifiers.AddDefaulted_GetRef();
+	InfoXP.ModifierMagnitude = FGameplayEffectModifierMagnitude(XPSetByCaller);
+	InfoXP.ModifierOp = EGameplayModOp::Additive;
+	InfoXP.Attribute = UGASAttributeSetEconomy::GetXPAttribute();
+
+	FSetByCallerFloat GoldSetByCaller;
+	GoldSetByCaller.DataName = GoldDataName;
+
+	FGameplayModifierInfo& InfoGold = Modifiers.AddDefaulted_GetRef();
+	InfoGold.ModifierMagnitude = FGameplayEffectModifierMagnitude(GoldSetByCaller);
+	InfoGold.ModifierOp = EGameplayModOp::Additive;
+	InfoGold.Attribute = UGASAttributeSetEconomy::GetGoldAttribute();
+}
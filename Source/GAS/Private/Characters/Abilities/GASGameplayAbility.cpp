@@ -3,6 +3,7 @@
 
 #include "Characters/Abilities/GASGameplayAbility.h"
 #include "AbilitySystemComponent.h"
+#include "Characters/Abilities/GASAbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
 
 UGASGameplayAbility::UGASGameplayAbility()
@@ -24,3 +25,17 @@ void UGASGameplayAbility::OnAvatarSet(const FGameplayAbilityActorInfo * ActorInf
 		ActorInfo->AbilitySystemComponent->TryActivateAbility(Spec.Handle, false);
 	}
 }
+
+void UGASGameplayAbility::ExternalEndAbility()
+{
+	if (IsActive())
+	{
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+	}
+}
+
+bool UGASGameplayAbility::WillEndInRPCBatch() const
+{
+	const UGASAbilitySystemComponent* ASC = Cast<UGASAbilitySystemComponent>(GetAbilitySystemComponentFromActorInfo());
+	return bBatchRPCs && bEndAbilityInRPCBatch && ASC && ASC->IsServerAbilityRPCBatched(CurrentSpecHandle);
+}
@@ -1,15 +1,28 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Characters/GASCharacterMain.h"
+#include "AIController.h"
+#include "Animation/AnimInstance.h"
+#include "BrainComponent.h"
 #include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
+#include "Characters/Abilities/AttributeSets/GASAttributeSetEconomy.h"
 #include "Characters/Abilities/GASAbilitySystemComponent.h"
+#include "Characters/Abilities/GASAttributeInitData.h"
 #include "Characters/Abilities/GASGameplayAbility.h"
 #include "Characters/GASCharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Characters/Heroes/Abilities/GASGA_FireGun.h"
 #include "CapsuleTypes.h"
+#include "GAS.h"
+#include "GASGameplayTags.h"
+#include "GASLagCompensationSubsystem.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include "GAS/Public/Characters/GASCharacterMain.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Character Abilities Given"), STAT_GASCharacterAbilitiesGiven, STATGROUP_GAS);
+
 // Sets default values
 
 
@@ -21,15 +34,7 @@ AGASCharacterMain::AGASCharacterMain(const class FObjectInitializer& ObjectIniti
 
 	GetCapsuleComponent()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Visibility, ECollisionResponse::ECR_Overlap);
 
-	bAlwaysRelevant = true;
-
-	// Cache tags
-	HitDirectionFrontTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Front"));
-	HitDirectionBackTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Back"));
-	HitDirectionRightTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Right"));
-	HitDirectionLeftTag = FGameplayTag::RequestGameplayTag(FName("Effect.HitReact.Left"));
-	DeadTag = FGameplayTag::RequestGameplayTag(FName("State.Dead"));
-	EffectRemoveOnDeathTag = FGameplayTag::RequestGameplayTag(FName("Effect.RemoveOnDeath"));
+	// Relevancy is decided by UGASReplicationGraph, heroes are never culled and minions are spatialized
 }
 
 UAbilitySystemComponent * AGASCharacterMain::GetAbilitySystemComponent() const
@@ -54,22 +59,13 @@ void AGASCharacterMain::RemoveCharacterAbilities()
 		return;
 	}
 
-	// Remove any abilities added from a previous call. This checks to make sure the ability is in the startup 'CharacterAbilities' array.
-	TArray<FGameplayAbilitySpecHandle> AbilitiesToRemove;
-	for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+	// Remove the abilities added by AddCharacterAbilities()
+	for (const FGameplayAbilitySpecHandle& Handle : AbilitySystemComponent->CharacterAbilityHandles)
 	{
-		if ((Spec.SourceObject == this) && CharacterAbilities.Contains(Spec.Ability->GetClass()))
-		{
-			AbilitiesToRemove.Add(Spec.Handle);
-		}
-	}
-
-	// Do in two passes so the removal happens after we have the full list
-	for (int32 i = 0; i < AbilitiesToRemove.Num(); i++)
-	{
-		AbilitySystemComponent->ClearAbility(AbilitiesToRemove[i]);
+		AbilitySystemComponent->ClearAbility(Handle);
 	}
 
+	AbilitySystemComponent->CharacterAbilityHandles.Reset();
 	AbilitySystemComponent->bCharacterAbilitiesGiven = false;
 }
 
@@ -112,32 +108,52 @@ EGASHitReactDirection AGASCharacterMain::GetHitReactDirection(const FVector & Im
 	return EGASHitReactDirection::Front;
 }
 
-void AGASCharacterMain::PlayHitReact_Implementation(FGameplayTag HitDirection, AActor * DamageCauser)
+void AGASCharacterMain::PlayHitReact(EGASHitReactDirection HitDirection, AActor * DamageCauser)
 {
-	if (IsAlive())
+	if (!HasAuthority())
 	{
-		if (HitDirection == HitDirectionLeftTag)
-		{
-			ShowHitReact.Broadcast(EGASHitReactDirection::Left);
-		}
-		else if (HitDirection == HitDirectionFrontTag)
-		{
-			ShowHitReact.Broadcast(EGASHitReactDirection::Front);
-		}
-		else if (HitDirection == HitDirectionRightTag)
-		{
-			ShowHitReact.Broadcast(EGASHitReactDirection::Right);
-		}
-		else if (HitDirection == HitDirectionBackTag)
-		{
-			ShowHitReact.Broadcast(EGASHitReactDirection::Back);
-		}
+		return;
+	}
+
+	HitReact.Direction = HitDirection;
+	HitReact.Counter++;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AGASCharacterMain, HitReact, this);
+
+	// OnRep doesn't run on the Server. Listen servers still need to see the hit react.
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		BroadcastHitReact(HitDirection);
 	}
 }
 
-bool AGASCharacterMain::PlayHitReact_Validate(FGameplayTag HitDirection, AActor * DamageCauser)
+void AGASCharacterMain::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	return true;
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AGASCharacterMain, HitReact, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AGASCharacterMain, bCharacterActive, Params);
+}
+
+void AGASCharacterMain::OnRep_HitReact()
+{
+	// Initial replication of a character that just became relevant carries an old hit react, don't play it
+	if (!HasActorBegunPlay())
+	{
+		return;
+	}
+
+	BroadcastHitReact(HitReact.Direction);
+}
+
+void AGASCharacterMain::BroadcastHitReact(EGASHitReactDirection HitDirection)
+{
+	if (IsAlive() && HitDirection != EGASHitReactDirection::None)
+	{
+		ShowHitReact.Broadcast(HitDirection);
+	}
 }
 
 int32 AGASCharacterMain::GetCharacterLevel() const
@@ -230,11 +246,42 @@ float AGASCharacterMain::GetMoveSpeedBaseValue() const
 	return 0.0f;
 }
 
+float AGASCharacterMain::GetXPBounty() const
+{
+	if (AbilitySystemComponent.IsValid())
+	{
+		const UGASAttributeSetEconomy* AttributeSetEconomy = AbilitySystemComponent->GetSet<UGASAttributeSetEconomy>();
+		if (AttributeSetEconomy)
+		{
+			return AttributeSetEconomy->GetXPBounty();
+		}
+	}
+
+	return 0.0f;
+}
+
+float AGASCharacterMain::GetGoldBounty() const
+{
+	if (AbilitySystemComponent.IsValid())
+	{
+		const UGASAttributeSetEconomy* AttributeSetEconomy = AbilitySystemComponent->GetSet<UGASAttributeSetEconomy>();
+		if (AttributeSetEconomy)
+		{
+			return AttributeSetEconomy->GetGoldBounty();
+		}
+	}
+
+	return 0.0f;
+}
+
 // Run on Server and all clients
 void AGASCharacterMain::Die()
 {
 	// Only runs on Server
-	RemoveCharacterAbilities();
+	if (!bKeepAbilitiesOnDeath)
+	{
+		RemoveCharacterAbilities();
+	}
 
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	GetCharacterMovement()->GravityScale = 0;
@@ -246,13 +293,20 @@ void AGASCharacterMain::Die()
 	{
 		AbilitySystemComponent->CancelAllAbilities();
 
+		const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
 		FGameplayTagContainer EffectTagsToRemove;
-		EffectTagsToRemove.AddTag(EffectRemoveOnDeathTag);
+		EffectTagsToRemove.AddTag(GameplayTags.Effect_RemoveOnDeath);
 		int32 NumEffectsRemoved = AbilitySystemComponent->RemoveActiveEffectsWithTags(EffectTagsToRemove);
 
-		AbilitySystemComponent->AddLooseGameplayTag(DeadTag);
+		// Replicated so the owning client also stops predicting the abilities kept through death (bKeepAbilitiesOnDeath)
+		AbilitySystemComponent->AddLooseGameplayTag(GameplayTags.State_Dead);
+		AbilitySystemComponent->AddReplicatedLooseGameplayTag(GameplayTags.State_Dead);
 	}
 
+	// The death still goes out with the last update before the channel goes dormant
+	UpdateNetDormancy();
+
 	if (DeathMontage)
 	{
 		PlayAnimMontage(DeathMontage);
@@ -268,10 +322,200 @@ void AGASCharacterMain::FinishDying()
 	Destroy();
 }
 
+void AGASCharacterMain::DeactivateCharacter()
+{
+	if (!HasAuthority() || !bCharacterActive)
+	{
+		return;
+	}
+
+	// Wake before changing anything so the deactivation replicates, UpdateNetDormancy() puts it back to sleep
+	if (NetDormancy > DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	if (!bKeepAbilitiesOnDeath)
+	{
+		RemoveCharacterAbilities();
+	}
+
+	if (AbilitySystemComponent.IsValid())
+	{
+		AbilitySystemComponent->CancelAllAbilities();
+
+		// Heroes' ASCs live on the PlayerState and keep their effects through death like they did before reuse.
+		// An ASC owned by this character loses everything, not only Effect.RemoveOnDeath. Startup effects are applied again on reactivation.
+		if (AbilitySystemComponent->GetOwnerActor() == this)
+		{
+			AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+			AbilitySystemComponent->bStartupEffectsApplied = false;
+		}
+	}
+
+	AAIController* AIController = Cast<AAIController>(GetController());
+	if (AIController)
+	{
+		AIController->StopMovement();
+
+		if (AIController->GetBrainComponent())
+		{
+			AIController->GetBrainComponent()->StopLogic(TEXT("Character deactivated"));
+		}
+	}
+
+	bCharacterActive = false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AGASCharacterMain, bCharacterActive, this);
+	ApplyCharacterActiveState();
+	ForceNetUpdate();
+
+	UpdateNetDormancy();
+}
+
+void AGASCharacterMain::ReactivateCharacter(const FTransform& SpawnTransform)
+{
+	if (!HasAuthority() || bCharacterActive)
+	{
+		return;
+	}
+
+	if (NetDormancy > DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	bCharacterActive = true;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AGASCharacterMain, bCharacterActive, this);
+	ApplyCharacterActiveState();
+
+	ReinitializeAbilitySystem();
+
+	AAIController* AIController = Cast<AAIController>(GetController());
+	if (AIController && AIController->GetBrainComponent())
+	{
+		AIController->GetBrainComponent()->RestartLogic();
+	}
+
+	ForceNetUpdate();
+
+	// Restarts the out of combat timer
+	NotifyCombatActivity();
+}
+
+void AGASCharacterMain::ReinitializeAbilitySystem()
+{
+	if (!AbilitySystemComponent.IsValid())
+	{
+		return;
+	}
+
+	// Forcibly set the DeadTag count to 0, here and on clients
+	AbilitySystemComponent->SetTagMapCount(FGASGameplayTags::Get().State_Dead, 0);
+	AbilitySystemComponent->SetReplicatedLooseGameplayTagCount(FGASGameplayTags::Get().State_Dead, 0);
+
+	InitializeAttributes();
+
+	SetHealth(GetMaxHealth());
+	SetMana(GetMaxMana());
+	SetStamina(GetMaxStamina());
+
+	AddStartupEffects();
+	AddCharacterAbilities();
+}
+
+bool AGASCharacterMain::IsCharacterActive() const
+{
+	return bCharacterActive;
+}
+
+void AGASCharacterMain::OnServerMovementUpdated(bool bMoving)
+{
+	if (!UsesAutoNetDormancy())
+	{
+		return;
+	}
+
+	if (bMoving)
+	{
+		LastMovingTime = GetWorld()->GetTimeSeconds();
+
+		if (NetDormancy > DORM_Awake)
+		{
+			UpdateNetDormancy();
+		}
+	}
+	else if (NetDormancy == DORM_Awake && IsStillForDormancy())
+	{
+		// Stopped after moving while dead or stunned, or out of combat but was still moving when the timer expired
+		UpdateNetDormancy();
+	}
+}
+
+void AGASCharacterMain::OnRep_CharacterActive()
+{
+	ApplyCharacterActiveState();
+}
+
+void AGASCharacterMain::ApplyCharacterActiveState()
+{
+	SetActorHiddenInGame(!bCharacterActive);
+	SetActorEnableCollision(bCharacterActive);
+
+	UCharacterMovementComponent* Movement = GetCharacterMovement();
+
+	if (bCharacterActive)
+	{
+		// Undo what Die() changed
+		const AGASCharacterMain* DefaultCharacter = GetClass()->GetDefaultObject<AGASCharacterMain>();
+		GetCapsuleComponent()->SetCollisionEnabled(DefaultCharacter->GetCapsuleComponent()->GetCollisionEnabled());
+
+		if (Movement)
+		{
+			Movement->GravityScale = DefaultCharacter->GetCharacterMovement()->GravityScale;
+			Movement->SetComponentTickEnabled(true);
+			Movement->SetDefaultMovementMode();
+		}
+
+		UAnimInstance* AnimInstance = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr;
+		if (AnimInstance)
+		{
+			AnimInstance->StopAllMontages(0.0f);
+		}
+	}
+	else if (Movement)
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+		Movement->SetComponentTickEnabled(false);
+	}
+}
+
 // Called when the game starts or when spawned
 void AGASCharacterMain::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (HasAuthority())
+	{
+		UGASLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UGASLagCompensationSubsystem>();
+		if (LagCompensation)
+		{
+			LagCompensation->RegisterCharacter(this);
+		}
+	}
+}
+
+void AGASCharacterMain::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGASLagCompensationSubsystem* LagCompensation = GetWorld() ? GetWorld()->GetSubsystem<UGASLagCompensationSubsystem>() : nullptr;
+	if (LagCompensation)
+	{
+		LagCompensation->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AGASCharacterMain::AddCharacterAbilities()
@@ -282,10 +526,13 @@ void AGASCharacterMain::AddCharacterAbilities()
 		return;
 	}
 
+	INC_DWORD_STAT_BY(STAT_GASCharacterAbilitiesGiven, CharacterAbilities.Num());
+
+	AbilitySystemComponent->CharacterAbilityHandles.Reset(CharacterAbilities.Num());
 	for (TSubclassOf<UGASGameplayAbility>& StartupAbility : CharacterAbilities)
 	{
-		AbilitySystemComponent->GiveAbility(
-			FGameplayAbilitySpec(StartupAbility, GetAbilityLevel(StartupAbility.GetDefaultObject()->AbilityID), static_cast<int32>(StartupAbility.GetDefaultObject()->AbilityInputID), this));
+		AbilitySystemComponent->CharacterAbilityHandles.Add(AbilitySystemComponent->GiveAbility(
+			FGameplayAbilitySpec(StartupAbility, GetAbilityLevel(StartupAbility.GetDefaultObject()->AbilityID), static_cast<int32>(StartupAbility.GetDefaultObject()->AbilityInputID), this)));
 	}
 
 	AbilitySystemComponent->bCharacterAbilitiesGiven = true;
@@ -298,6 +545,16 @@ void AGASCharacterMain::InitializeAttributes()
 		return;
 	}
 
+	if (AttributeInitData && AttributeInitData->Attributes.Num() > 0)
+	{
+		// Server only. On clients the baked values would overwrite replicated ones with level defaults,
+		// e.g. for a damaged minion becoming relevant again.
+		if (!HasAuthority() || AttributeInitData->ApplyToAbilitySystem(AbilitySystemComponent.Get(), GetCharacterLevel()))
+		{
+			return;
+		}
+	}
+
 	if (!DefaultAttributes)
 	{
 		UE_LOG(LogTemp, Error, TEXT("%s() Missing DefaultAttributes for %s. Please fill in the character's Blueprint."), *FString(__FUNCTION__), *GetName());
@@ -325,18 +582,220 @@ void AGASCharacterMain::AddStartupEffects()
 	FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
 	EffectContext.AddSourceObject(this);
 
+	TArray<FGameplayEffectSpecHandle> Specs;
+	Specs.Reserve(StartupEffects.Num());
+
 	for (TSubclassOf<UGameplayEffect> GameplayEffect : StartupEffects)
 	{
 		FGameplayEffectSpecHandle NewHandle = AbilitySystemComponent->MakeOutgoingSpec(GameplayEffect, GetCharacterLevel(), EffectContext);
 		if (NewHandle.IsValid())
 		{
-			FActiveGameplayEffectHandle ActiveGEHandle = AbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*NewHandle.Data.Get(), AbilitySystemComponent.Get());
+			Specs.Add(NewHandle);
 		}
 	}
 
+	AbilitySystemComponent->ApplyGameplayEffectSpecsToSelf(Specs);
+
 	AbilitySystemComponent->bStartupEffectsApplied = true;
 }
 
+void AGASCharacterMain::BindMovementToAbilitySystem()
+{
+	UGASCharacterMovementComponent* GASMovement = Cast<UGASCharacterMovementComponent>(GetCharacterMovement());
+	if (GASMovement)
+	{
+		GASMovement->BindToAbilitySystem(AbilitySystemComponent.Get());
+	}
+}
+
+void AGASCharacterMain::BindNetDormancyToAbilitySystem()
+{
+	if (!bAutoNetDormancy || !HasAuthority() || !AbilitySystemComponent.IsValid() || NetDormancyAbilitySystemComponent == AbilitySystemComponent)
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* OldASC = NetDormancyAbilitySystemComponent.Get();
+	if (OldASC)
+	{
+		OldASC->OnGameplayEffectAppliedDelegateToSelf.RemoveAll(this);
+		OldASC->AbilityActivatedCallbacks.RemoveAll(this);
+		OldASC->RegisterGameplayTagEvent(FGASGameplayTags::Get().State_Dead).RemoveAll(this);
+		OldASC->RegisterGameplayTagEvent(FGASGameplayTags::Get().State_Debuff_Stun).RemoveAll(this);
+
+		TArray<FGameplayAttribute> OldAttributes;
+		OldASC->GetAllAttributes(OldAttributes);
+		for (const FGameplayAttribute& Attribute : OldAttributes)
+		{
+			OldASC->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		}
+	}
+
+	UAbilitySystemComponent* ASC = AbilitySystemComponent.Get();
+	NetDormancyAbilitySystemComponent = ASC;
+
+	ASC->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &AGASCharacterMain::NetDormancyEffectApplied);
+	ASC->AbilityActivatedCallbacks.AddUObject(this, &AGASCharacterMain::NetDormancyAbilityActivated);
+	// Only the tags that ShouldStayNetDormant() looks at
+	ASC->RegisterGameplayTagEvent(FGASGameplayTags::Get().State_Dead).AddUObject(this, &AGASCharacterMain::NetDormancyTagChanged);
+	ASC->RegisterGameplayTagEvent(FGASGameplayTags::Get().State_Debuff_Stun).AddUObject(this, &AGASCharacterMain::NetDormancyTagChanged);
+
+	// Damage is a Health change so it is covered here too
+	TArray<FGameplayAttribute> Attributes;
+	ASC->GetAllAttributes(Attributes);
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &AGASCharacterMain::NetDormancyAttributeChanged);
+	}
+
+	NotifyCombatActivity();
+}
+
+bool AGASCharacterMain::UsesAutoNetDormancy() const
+{
+	return bAutoNetDormancy && NetDormancyAbilitySystemComponent.IsValid() && HasAuthority();
+}
+
+bool AGASCharacterMain::ShouldStayNetDormant() const
+{
+	if (!bCharacterActive)
+	{
+		return true;
+	}
+
+	// Knockbacks, falls and root motion still have to replicate
+	if (!IsStillForDormancy())
+	{
+		return false;
+	}
+
+	if (!IsAlive())
+	{
+		return true;
+	}
+
+	// Players' own pawns stay awake while alive, their moves and corrections go through this actor
+	const UAbilitySystemComponent* ASC = NetDormancyAbilitySystemComponent.Get();
+	if (!ASC || IsPlayerControlled() || !ASC->HasMatchingGameplayTag(FGASGameplayTags::Get().State_Debuff_Stun))
+	{
+		return false;
+	}
+
+	// Periodic effects keep changing attributes while stunned
+	for (FActiveGameplayEffectsContainer::ConstIterator It = ASC->GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+	{
+		if (It->Spec.GetPeriod() > 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool AGASCharacterMain::ShouldBeNetDormant() const
+{
+	if (ShouldStayNetDormant())
+	{
+		return true;
+	}
+
+	return !IsPlayerControlled() && IsStillForDormancy() && GetWorld()->GetTimeSeconds() - LastCombatActivityTime >= OutOfCombatDormancyDelay;
+}
+
+bool AGASCharacterMain::IsStillForDormancy() const
+{
+	return GetVelocity().IsNearlyZero() && GetWorld()->GetTimeSeconds() - LastMovingTime >= StillDormancyDelay;
+}
+
+void AGASCharacterMain::UpdateNetDormancy()
+{
+	if (!UsesAutoNetDormancy())
+	{
+		return;
+	}
+
+	if (ShouldBeNetDormant())
+	{
+		if (NetDormancy == DORM_Awake)
+		{
+			SetNetDormancy(DORM_DormantAll);
+		}
+	}
+	else if (NetDormancy > DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+}
+
+void AGASCharacterMain::NotifyCombatActivity()
+{
+	if (!UsesAutoNetDormancy())
+	{
+		return;
+	}
+
+	if (ShouldStayNetDormant())
+	{
+		// Send the change once and stay dormant
+		if (NetDormancy > DORM_Awake)
+		{
+			FlushNetDormancy();
+		}
+		else
+		{
+			UpdateNetDormancy();
+		}
+
+		return;
+	}
+
+	LastCombatActivityTime = GetWorld()->GetTimeSeconds();
+
+	if (NetDormancy > DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	// Activity only moves LastCombatActivityTime, the timer re-arms itself for the remaining time when it expires
+	if (!GetWorldTimerManager().IsTimerActive(OutOfCombatTimerHandle))
+	{
+		GetWorldTimerManager().SetTimer(OutOfCombatTimerHandle, this, &AGASCharacterMain::OutOfCombatTimerExpired, OutOfCombatDormancyDelay, false);
+	}
+}
+
+void AGASCharacterMain::OutOfCombatTimerExpired()
+{
+	const float RemainingTime = LastCombatActivityTime + OutOfCombatDormancyDelay - GetWorld()->GetTimeSeconds();
+	if (RemainingTime > 0.0f)
+	{
+		GetWorldTimerManager().SetTimer(OutOfCombatTimerHandle, this, &AGASCharacterMain::OutOfCombatTimerExpired, RemainingTime, false);
+		return;
+	}
+
+	UpdateNetDormancy();
+}
+
+void AGASCharacterMain::NetDormancyEffectApplied(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	NotifyCombatActivity();
+}
+
+void AGASCharacterMain::NetDormancyAbilityActivated(UGameplayAbility* Ability)
+{
+	NotifyCombatActivity();
+}
+
+void AGASCharacterMain::NetDormancyTagChanged(const FGameplayTag CallbackTag, int32 NewCount)
+{
+	NotifyCombatActivity();
+}
+
+void AGASCharacterMain::NetDormancyAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	NotifyCombatActivity();
+}
+
 void AGASCharacterMain::SetHealth(float Health)
 {
 	if (AttributeSetBase.IsValid())
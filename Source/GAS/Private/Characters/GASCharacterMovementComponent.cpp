@@ -3,93 +3,229 @@
 
 #include "..\..\Public\Characters\GASCharacterMovementComponent.h"
 #include "AbilitySystemComponent.h"
+#include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
 #include "Characters/GASCharacterMain.h"
 #include "GameplayTagContainer.h"
+#include "GAS.h"
+#include "GASGameplayTags.h"
+
+DECLARE_CYCLE_STAT(TEXT("GAS Character PerformMovement"), STAT_GASPerformMovement, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Character Moves"), STAT_GASCharacterMoves, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Max Speed Cache Updates"), STAT_GASMaxSpeedCacheUpdates, STATGROUP_GAS);
 
 UGASCharacterMovementComponent::UGASCharacterMovementComponent()
 {
 	SprintSpeedMultiplier = 1.4f;
 	ADSSpeedMultiplier = 0.5f;
+
+	bUseCachedMaxSpeed = true;
+	CachedMaxSpeed = 0.0f;
+	CachedMoveSpeed = 0.0f;
+	CachedHealth = 0.0f;
+	bMovementBlockedByTags = false;
 }
 
 float UGASCharacterMovementComponent::GetMaxSpeed() const
 {
-	AGASCharacterMain* Owner = Cast<AGASCharacterMain>(GetOwner());
-	if (!Owner)
+	return bUseCachedMaxSpeed ? CachedMaxSpeed : Super::GetMaxSpeed();
+}
+
+void UGASCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	//The Flags parameter contains the compressed input flags that are stored in the saved move.
+	//UpdateFromCompressed flags simply copies the flags from the saved move into the movement component.
+	//It basically just resets the movement component to the state when the move was made so it can simulate from there.
+	const bool bWantsToSprint = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	const bool bWantsToADS = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+
+	if (bWantsToSprint != RequestToStartSprinting || bWantsToADS != RequestToStartADS)
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s() No Owner"), *FString(__FUNCTION__));
-		return Super::GetMaxSpeed();
+		RequestToStartSprinting = bWantsToSprint;
+		RequestToStartADS = bWantsToADS;
+		UpdateCachedMaxSpeed();
 	}
+}
+
+FNetworkPredictionData_Client * UGASCharacterMovementComponent::GetPredictionData_Client() const
+{
+	check(PawnOwner != NULL);
 
-	if (!Owner->IsAlive())
+	if (!ClientPredictionData)
 	{
-		return 0.0f;
+		UGASCharacterMovementComponent* MutableThis = const_cast<UGASCharacterMovementComponent*>(this);
+
+		MutableThis->ClientPredictionData = new FGDNetworkPredictionData_Client(*this);
+		MutableThis->ClientPredictionData->MaxSmoothNetUpdateDist = 92.f;
+		MutableThis->ClientPredictionData->NoSmoothNetUpdateDist = 140.f;
 	}
 
-	if (Owner->GetAbilitySystemComponent()->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("State.Debuff.Stun"))))
+	return ClientPredictionData;
+}
+
+void UGASCharacterMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!Cast<AGASCharacterMain>(GetOwner()))
 	{
-		return 0.0f;
+		UE_LOG(LogTemp, Error, TEXT("%s() Owner is not an AGASCharacterMain, max speed will not be driven by attributes"), *FString(__FUNCTION__));
+		bUseCachedMaxSpeed = false;
 	}
+}
+
+void UGASCharacterMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The ASC can outlive us (Heroes keep theirs on the PlayerState)
+	UnbindFromAbilitySystem();
+
+	Super::EndPlay(EndPlayReason);
+}
 
-	if (RequestToStartSprinting)
+void UGASCharacterMovementComponent::BindToAbilitySystem(UAbilitySystemComponent* InAbilitySystemComponent)
+{
+	if (BoundAbilitySystemComponent.Get() == InAbilitySystemComponent)
 	{
-		return Owner->GetMoveSpeed() * SprintSpeedMultiplier;
+		return;
 	}
 
-	if (RequestToStartADS)
+	UnbindFromAbilitySystem();
+
+	BoundAbilitySystemComponent = InAbilitySystemComponent;
+
+	if (InAbilitySystemComponent)
+	{
+		const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
+		MoveSpeedChangedDelegateHandle = InAbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(UGASAttributeSetBase::GetMoveSpeedAttribute()).AddUObject(this, &UGASCharacterMovementComponent::MoveSpeedChanged);
+		HealthChangedDelegateHandle = InAbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(UGASAttributeSetBase::GetHealthAttribute()).AddUObject(this, &UGASCharacterMovementComponent::HealthChanged);
+		StunTagChangedDelegateHandle = InAbilitySystemComponent->RegisterGameplayTagEvent(GameplayTags.State_Debuff_Stun, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UGASCharacterMovementComponent::BlockingTagChanged);
+		DeadTagChangedDelegateHandle = InAbilitySystemComponent->RegisterGameplayTagEvent(GameplayTags.State_Dead, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UGASCharacterMovementComponent::BlockingTagChanged);
+
+		CachedMoveSpeed = InAbilitySystemComponent->GetNumericAttribute(UGASAttributeSetBase::GetMoveSpeedAttribute());
+		CachedHealth = InAbilitySystemComponent->GetNumericAttribute(UGASAttributeSetBase::GetHealthAttribute());
+		bMovementBlockedByTags = InAbilitySystemComponent->HasMatchingGameplayTag(GameplayTags.State_Debuff_Stun) || InAbilitySystemComponent->HasMatchingGameplayTag(GameplayTags.State_Dead);
+	}
+	else
 	{
-		return Owner->GetMoveSpeed() * ADSSpeedMultiplier;
+		CachedMoveSpeed = 0.0f;
+		CachedHealth = 0.0f;
+		bMovementBlockedByTags = false;
 	}
 
-	return Owner->GetMoveSpeed();
+	UpdateCachedMaxSpeed();
 }
 
-void UGASCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+void UGASCharacterMovementComponent::UnbindFromAbilitySystem()
 {
-	Super::UpdateFromCompressedFlags(Flags);
+	UAbilitySystemComponent* ASC = BoundAbilitySystemComponent.Get();
+	if (ASC)
+	{
+		const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
 
-	//The Flags parameter contains the compressed input flags that are stored in the saved move.
-	//UpdateFromCompressed flags simply copies the flags from the saved move into the movement component.
-	//It basically just resets the movement component to the state when the move was made so it can simulate from there.
-	RequestToStartSprinting = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+		ASC->GetGameplayAttributeValueChangeDelegate(UGASAttributeSetBase::GetMoveSpeedAttribute()).Remove(MoveSpeedChangedDelegateHandle);
+		ASC->GetGameplayAttributeValueChangeDelegate(UGASAttributeSetBase::GetHealthAttribute()).Remove(HealthChangedDelegateHandle);
+		ASC->RegisterGameplayTagEvent(GameplayTags.State_Debuff_Stun, EGameplayTagEventType::NewOrRemoved).Remove(StunTagChangedDelegateHandle);
+		ASC->RegisterGameplayTagEvent(GameplayTags.State_Dead, EGameplayTagEventType::NewOrRemoved).Remove(DeadTagChangedDelegateHandle);
+	}
 
-	RequestToStartADS = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	MoveSpeedChangedDelegateHandle.Reset();
+	HealthChangedDelegateHandle.Reset();
+	StunTagChangedDelegateHandle.Reset();
+	DeadTagChangedDelegateHandle.Reset();
+	BoundAbilitySystemComponent.Reset();
 }
 
-FNetworkPredictionData_Client * UGASCharacterMovementComponent::GetPredictionData_Client() const
+void UGASCharacterMovementComponent::UpdateCachedMaxSpeed()
 {
-	check(PawnOwner != NULL);
+	INC_DWORD_STAT(STAT_GASMaxSpeedCacheUpdates);
 
-	if (!ClientPredictionData)
+	// Health arrives on clients with the other attributes, so the owning client agrees on a dead character's speed without waiting on State.Dead
+	if (bMovementBlockedByTags || CachedHealth <= 0.0f || CachedMoveSpeed <= 0.0f)
 	{
-		UGASCharacterMovementComponent* MutableThis = const_cast<UGASCharacterMovementComponent*>(this);
+		CachedMaxSpeed = 0.0f;
+	}
+	else if (RequestToStartSprinting)
+	{
+		CachedMaxSpeed = CachedMoveSpeed * SprintSpeedMultiplier;
+	}
+	else if (RequestToStartADS)
+	{
+		CachedMaxSpeed = CachedMoveSpeed * ADSSpeedMultiplier;
+	}
+	else
+	{
+		CachedMaxSpeed = CachedMoveSpeed;
+	}
+}
 
-		MutableThis->ClientPredictionData = new FGDNetworkPredictionData_Client(*this);
-		MutableThis->ClientPredictionData->MaxSmoothNetUpdateDist = 92.f;
-		MutableThis->ClientPredictionData->NoSmoothNetUpdateDist = 140.f;
+void UGASCharacterMovementComponent::MoveSpeedChanged(const FOnAttributeChangeData& Data)
+{
+	CachedMoveSpeed = Data.NewValue;
+	UpdateCachedMaxSpeed();
+}
+
+void UGASCharacterMovementComponent::HealthChanged(const FOnAttributeChangeData& Data)
+{
+	// Only alive/dead matters here
+	const bool bWasAlive = CachedHealth > 0.0f;
+	CachedHealth = Data.NewValue;
+	if (bWasAlive != (CachedHealth > 0.0f))
+	{
+		UpdateCachedMaxSpeed();
 	}
+}
 
-	return ClientPredictionData;
+void UGASCharacterMovementComponent::BlockingTagChanged(const FGameplayTag CallbackTag, int32 NewCount)
+{
+	UAbilitySystemComponent* ASC = BoundAbilitySystemComponent.Get();
+	if (ASC)
+	{
+		const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+		bMovementBlockedByTags = ASC->HasMatchingGameplayTag(GameplayTags.State_Debuff_Stun) || ASC->HasMatchingGameplayTag(GameplayTags.State_Dead);
+	}
+
+	UpdateCachedMaxSpeed();
+}
+
+void UGASCharacterMovementComponent::PerformMovement(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASPerformMovement);
+	INC_DWORD_STAT(STAT_GASCharacterMoves);
+
+	Super::PerformMovement(DeltaTime);
+
+	// Idle net dormancy has to end as soon as the character moves again
+	AGASCharacterMain* GASCharacter = CharacterOwner && CharacterOwner->HasAuthority() ? Cast<AGASCharacterMain>(CharacterOwner) : nullptr;
+	if (GASCharacter)
+	{
+		GASCharacter->OnServerMovementUpdated(!Velocity.IsNearlyZero());
+	}
 }
 
 void UGASCharacterMovementComponent::StartSprinting()
 {
 	RequestToStartSprinting = true;
+	UpdateCachedMaxSpeed();
 }
 
 void UGASCharacterMovementComponent::StopSprinting()
 {
 	RequestToStartSprinting = false;
+	UpdateCachedMaxSpeed();
 }
 
 void UGASCharacterMovementComponent::StartAimDownSights()
 {
 	RequestToStartADS = true;
+	UpdateCachedMaxSpeed();
 }
 
 void UGASCharacterMovementComponent::StopAimDownSights()
 {
 	RequestToStartADS = false;
+	UpdateCachedMaxSpeed();
 }
 
 void UGASCharacterMovementComponent::FGASSavedMove::Clear()
@@ -2,7 +2,51 @@
 
 
 #include "..\..\Public\Characters\GASProjectile.h"
+#include "Characters/GASCharacterMain.h"
+#include "Engine/NetSerialization.h"
+#include "Engine/World.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "GASLagCompensationSubsystem.h"
+#include "GASProjectileSubsystem.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/UnrealNetwork.h"
+
+bool FGASProjectileSpawn::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	UObject* Class = ProjectileClass.Get();
+	bOutSuccess = Map->SerializeObject(Ar, UClass::StaticClass(), Class);
+
+	UObject* InstigatorObject = Instigator;
+	Map->SerializeObject(Ar, AGASCharacterMain::StaticClass(), InstigatorObject);
+
+	// Origin to 0.1cm, velocity to 1cm/s
+	bOutSuccess &= SerializePackedVector<10, 24>(Origin, Ar);
+	bOutSuccess &= SerializePackedVector<1, 20>(Velocity, Ar);
+
+	uint32 QuantizedRange = Ar.IsSaving() ? static_cast<uint32>(FMath::RoundToInt(FMath::Max(Range, 0.0f))) : 0;
+	Ar.SerializeIntPacked(QuantizedRange);
+	Ar.SerializeIntPacked(ProjectileId);
+
+	bool bPredicted = PredictionKey != 0;
+	Ar.SerializeBits(&bPredicted, 1);
+	if (bPredicted)
+	{
+		Ar << PredictionKey;
+	}
+	else if (Ar.IsLoading())
+	{
+		PredictionKey = 0;
+	}
+
+	if (Ar.IsLoading())
+	{
+		ProjectileClass = Cast<UClass>(Class);
+		Instigator = Cast<AGASCharacterMain>(InstigatorObject);
+		Range = QuantizedRange;
+	}
+
+	return true;
+}
 
 // Sets default values
 AGASProjectile::AGASProjectile()
@@ -13,12 +57,177 @@ AGASProjectile::AGASProjectile()
 	bReplicates = true;
 
 	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(FName("ProjectileMovement"));
+
+	bRequiresActor = false;
+	SimulatedRadius = 5.0f;
+	bPooled = false;
+	RewindOffset = 0.0f;
+}
+
+bool AGASProjectile::CanBeSimulated(TSubclassOf<AGASProjectile> ProjectileClass)
+{
+	const AGASProjectile* DefaultProjectile = ProjectileClass ? ProjectileClass.GetDefaultObject() : nullptr;
+	return DefaultProjectile && !DefaultProjectile->bRequiresActor && DefaultProjectile->SimulatedMesh;
+}
+
+void AGASProjectile::ActivateFromPool(const FTransform& SpawnTransform, float NewRange, const FGameplayEffectSpecHandle& NewDamageEffectSpecHandle)
+{
+	// Reopens the dormant channel, the client keeps its actor
+	SetNetDormancy(DORM_Awake);
+
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	Range = NewRange;
+	DamageEffectSpecHandle = NewDamageEffectSpecHandle;
+	SetLifeSpan(GetClass()->GetDefaultObject<AActor>()->InitialLifeSpan);
+	UpdateRewindOffset();
+
+	const float Speed = ProjectileMovement->InitialSpeed > 0.0f ? ProjectileMovement->InitialSpeed : ProjectileMovement->MaxSpeed;
+
+	PoolState.bActive = true;
+	PoolState.Counter++;
+	PoolState.Location = SpawnTransform.GetLocation();
+	PoolState.Velocity = SpawnTransform.GetRotation().GetForwardVector() * Speed;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AGASProjectile, PoolState, this);
+
+	ApplyPoolState();
+	ForceNetUpdate();
+}
+
+void AGASProjectile::DeactivateToPool()
+{
+	SetLifeSpan(0.0f);
+	DamageEffectSpecHandle.Clear();
+
+	PoolState.bActive = false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AGASProjectile, PoolState, this);
+
+	ApplyPoolState();
+
+	// The inactive state is sent once more before the channel goes dormant
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+}
+
+bool AGASProjectile::IsActiveInPool() const
+{
+	return PoolState.bActive;
+}
+
+void AGASProjectile::K2_DestroyActor()
+{
+	if (!bPooled)
+	{
+		Super::K2_DestroyActor();
+		return;
+	}
+
+	if (HasAuthority())
+	{
+		UGASProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UGASProjectileSubsystem>();
+		if (Projectiles)
+		{
+			Projectiles->ReleaseProjectileActor(this);
+			return;
+		}
+
+		Super::K2_DestroyActor();
+	}
+	else
+	{
+		// Clients can't destroy replicated actors anyway, hide it until the Server's state arrives
+		PoolState.bActive = false;
+		ApplyPoolState();
+	}
+}
+
+void AGASProjectile::LifeSpanExpired()
+{
+	if (bPooled)
+	{
+		K2_DestroyActor();
+		return;
+	}
+
+	Super::LifeSpanExpired();
+}
+
+void AGASProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AGASProjectile, PoolState, Params);
+}
+
+bool AGASProjectile::ValidateHit(AActor* HitActor, FVector HitLocation) const
+{
+	AGASCharacterMain* Target = Cast<AGASCharacterMain>(HitActor);
+	if (!Target)
+	{
+		return true;
+	}
+
+	const UGASLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UGASLagCompensationSubsystem>();
+	if (!LagCompensation)
+	{
+		return UGASLagCompensationSubsystem::ValidateLiveHit(Target, HitLocation, SimulatedRadius + 10.0f);
+	}
+
+	return LagCompensation->ValidateHit(Target, HitLocation, GetWorld()->GetTimeSeconds() - RewindOffset, SimulatedRadius + 10.0f);
 }
 
 // Called when the game starts or when spawned
 void AGASProjectile::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	UpdateRewindOffset();
+}
+
+void AGASProjectile::UpdateRewindOffset()
+{
+	const UGASLagCompensationSubsystem* LagCompensation = HasAuthority() ? GetWorld()->GetSubsystem<UGASLagCompensationSubsystem>() : nullptr;
+	RewindOffset = LagCompensation ? static_cast<float>(GetWorld()->GetTimeSeconds() - LagCompensation->GetRewindTime(GetInstigator())) : 0.0f;
 }
 
+void AGASProjectile::OnRep_PoolState()
+{
+	// Projectiles spawned active replicate their first transform with the actor
+	if (PoolState.Counter == 0 && PoolState.bActive && !bPooled)
+	{
+		return;
+	}
+
+	bPooled = true;
+
+	if (PoolState.bActive)
+	{
+		SetActorLocationAndRotation(PoolState.Location, PoolState.Velocity.Rotation(), false, nullptr, ETeleportType::ResetPhysics);
+	}
+
+	ApplyPoolState();
+}
+
+void AGASProjectile::ApplyPoolState()
+{
+	SetActorHiddenInGame(!PoolState.bActive);
+	SetActorEnableCollision(PoolState.bActive);
+	SetActorTickEnabled(PoolState.bActive);
+
+	if (PoolState.bActive)
+	{
+		ProjectileMovement->SetUpdatedComponent(GetRootComponent());
+		ProjectileMovement->Velocity = PoolState.Velocity;
+		ProjectileMovement->SetComponentTickEnabled(true);
+		ProjectileMovement->UpdateComponentVelocity();
+
+		OnActivatedFromPool();
+	}
+	else
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->SetComponentTickEnabled(false);
+	}
+}
@@ -6,6 +6,8 @@
 #include "Camera/CameraComponent.h"
 #include "Characters/Heroes/GASHeroCharacter.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "GASGameplayTags.h"
+#include "GASProjectileSubsystem.h"
 #include "Kismet/KismetMathLibrary.h"
 
 UGASGA_FireGun::UGASGA_FireGun()
@@ -20,6 +22,10 @@ UGASGA_FireGun::UGASGA_FireGun()
 
 	Range = 1000.0f;
 	Damage = 12.0f;
+
+	// Activation and end go to the Server in one batched RPC. The projectile fires on activation and the montage is only cosmetic.
+	bBatchRPCs = true;
+	bEndAbilityInRPCBatch = true;
 }
 
 void UGASGA_FireGun::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo * ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData * TriggerEventData)
@@ -27,18 +33,42 @@ void UGASGA_FireGun::ActivateAbility(const FGameplayAbilitySpecHandle Handle, co
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		return;
 	}
 
+	const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
 	UAnimMontage* MontageToPlay = FireHipMontage;
 
-	if (GetAbilitySystemComponentFromActorInfo()->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("State.AimDownSights"))) &&
-		!GetAbilitySystemComponentFromActorInfo()->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("State.AimDownSights.Removal"))))
+	if (GetAbilitySystemComponentFromActorInfo()->HasMatchingGameplayTag(GameplayTags.State_AimDownSights) &&
+		!GetAbilitySystemComponentFromActorInfo()->HasMatchingGameplayTag(GameplayTags.State_AimDownSights_Removal))
 	{
 		MontageToPlay = FireIronsightsMontage;
 	}
 
-	// Play fire montage and wait for event telling us to spawn the projectile
+	// Play fire montage. Without bEndAbilityInRPCBatch wait for the event telling us to spawn the projectile.
 	UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage* Task = UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage::PlayMontageAndWaitForEvent(this, NAME_None, MontageToPlay, FGameplayTagContainer(), 1.0f, NAME_None, false, 1.0f);
+
+	if (bEndAbilityInRPCBatch)
+	{
+		// The montage keeps playing after the ability ends
+		Task->ReadyForActivation();
+
+		if (!FireProjectile())
+		{
+			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+			return;
+		}
+
+		// The owning client's batch ends it so the end goes in the same RPC as the activation
+		if (!WillEndInRPCBatch())
+		{
+			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+		}
+
+		return;
+	}
+
 	Task->OnBlendOut.AddDynamic(this, &UGASGA_FireGun::OnCompleted);
 	Task->OnCompleted.AddDynamic(this, &UGASGA_FireGun::OnCompleted);
 	Task->OnInterrupted.AddDynamic(this, &UGASGA_FireGun::OnCancelled);
@@ -60,44 +90,91 @@ void UGASGA_FireGun::OnCompleted(FGameplayTag EventTag, FGameplayEventData Event
 
 void UGASGA_FireGun::EventReceived(FGameplayTag EventTag, FGameplayEventData EventData)
 {
+	const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
 	// Montage told us to end the ability before the montage finished playing.
 	// Montage was set to continue playing animation even after ability ends so this is okay.
-	if (EventTag == FGameplayTag::RequestGameplayTag(FName("Event.Montage.EndAbility")))
+	if (EventTag == GameplayTags.Event_Montage_EndAbility)
 	{
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 		return;
 	}
 
-	// Only spawn projectiles on the Server.
-	// Predicting projectiles is an advanced topic not covered in this example.
-	if (GetOwningActorFromActorInfo()->GetLocalRole() == ROLE_Authority && EventTag == FGameplayTag::RequestGameplayTag(FName("Event.Montage.SpawnProjectile")))
+	if (EventTag == GameplayTags.Event_Montage_SpawnProjectile && !FireProjectile())
+	{
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+	}
+}
+
+bool UGASGA_FireGun::FireProjectile()
+{
+	const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
+	const bool bIsServer = GetOwningActorFromActorInfo()->GetLocalRole() == ROLE_Authority;
+
+	// The Server spawns the real projectile. The owning client predicts a cosmetic one that the Server's takes over.
+	if (!bIsServer && !IsPredictingClient())
 	{
-		AGASHeroCharacter* Hero = Cast<AGASHeroCharacter>(GetAvatarActorFromActorInfo());
-		if (!Hero)
+		return true;
+	}
+
+	AGASHeroCharacter* Hero = Cast<AGASHeroCharacter>(GetAvatarActorFromActorInfo());
+	if (!Hero)
+	{
+		return false;
+	}
+
+	FTransform MuzzleTransform = Hero->GetMuzzleTransform();
+
+	FVector Start = MuzzleTransform.GetLocation();
+	FVector End = Hero->GetCameraBoom()->GetComponentLocation() + Hero->GetFollowCamera()->GetForwardVector() * Range;
+	FRotator Rotation = UKismetMathLibrary::FindLookAtRotation(Start, End);
+
+	UGASProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UGASProjectileSubsystem>();
+	const bool bSimulated = Projectiles && AGASProjectile::CanBeSimulated(ProjectileClass);
+
+	if (!bIsServer)
+	{
+		// Only simulated projectiles are predicted, projectile actors still appear when the Server spawns them
+		if (bSimulated)
 		{
-			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+			MuzzleTransform.SetRotation(Rotation.Quaternion());
+			Projectiles->FirePredictedProjectile(ProjectileClass, MuzzleTransform, Range, Hero, CurrentActivationInfo.GetActivationPredictionKey());
 		}
 
-		FVector Start = Hero->GetGunComponent()->GetSocketLocation(FName("Muzzle"));
-		FVector End = Hero->GetCameraBoom()->GetComponentLocation() + Hero->GetFollowCamera()->GetForwardVector() * Range;
-		FRotator Rotation = UKismetMathLibrary::FindLookAtRotation(Start, End);
+		return true;
+	}
 
-		FGameplayEffectSpecHandle DamageEffectSpecHandle = MakeOutgoingGameplayEffectSpec(DamageGameplayEffect, GetAbilityLevel());
-		
-		// Pass the damage to the Damage Execution Calculation through a SetByCaller value on the GameplayEffectSpec
-		DamageEffectSpecHandle.Data.Get()->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(FName("Data.Damage")), Damage);
+	FGameplayEffectSpecHandle DamageEffectSpecHandle = MakeOutgoingGameplayEffectSpec(DamageGameplayEffect, GetAbilityLevel());
+	
+	// Pass the damage to the Damage Execution Calculation through a SetByCaller value on the GameplayEffectSpec
+	DamageEffectSpecHandle.Data.Get()->SetSetByCallerMagnitude(GameplayTags.Data_Damage, Damage);
 
-		FTransform MuzzleTransform = Hero->GetGunComponent()->GetSocketTransform(FName("Muzzle"));
-		MuzzleTransform.SetRotation(Rotation.Quaternion());
-		MuzzleTransform.SetScale3D(FVector(1.0f));
+	MuzzleTransform.SetRotation(Rotation.Quaternion());
+	MuzzleTransform.SetScale3D(FVector(1.0f));
 
-		FActorSpawnParameters SpawnParameters;
-		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	// Simulated without an actor unless the projectile needs one
+	if (bSimulated)
+	{
+		Projectiles->FireProjectile(ProjectileClass, MuzzleTransform, Range, DamageEffectSpecHandle, Hero, CurrentActivationInfo.GetActivationPredictionKey().Current);
+		return true;
+	}
 
-		AGASProjectile* Projectile = GetWorld()->SpawnActorDeferred<AGASProjectile>(ProjectileClass, MuzzleTransform, GetOwningActorFromActorInfo(),
-			Hero, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
-		Projectile->DamageEffectSpecHandle = DamageEffectSpecHandle;
-		Projectile->Range = Range;
-		Projectile->FinishSpawning(MuzzleTransform);
+	// Pooled projectile actor
+	if (Projectiles)
+	{
+		Projectiles->SpawnProjectileActor(ProjectileClass, MuzzleTransform, Range, DamageEffectSpecHandle, GetOwningActorFromActorInfo(), Hero);
+		return true;
 	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AGASProjectile* Projectile = GetWorld()->SpawnActorDeferred<AGASProjectile>(ProjectileClass, MuzzleTransform, GetOwningActorFromActorInfo(),
+		Hero, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	Projectile->DamageEffectSpecHandle = DamageEffectSpecHandle;
+	Projectile->Range = Range;
+	Projectile->FinishSpawning(MuzzleTransform);
+
+	return true;
 }
@@ -3,7 +3,9 @@
 
 #include "Characters/Heroes/GASHeroCharacter.h"
 #include "..\..\..\Public\AI\GASHeroAIController.h"
+#include "Animation/AnimInstance.h"
 #include "Camera/CameraComponent.h"
+#include "Characters/Abilities/GASAnimNotify_GameplayEvent.h"
 #include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
 #include "Characters/Abilities/GASAbilitySystemComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -11,6 +13,8 @@
 #include "Components/WidgetComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GASGameMode.h"
+#include "GASGameplayTags.h"
+#include "GASMontageCacheSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Player/GASPlayerController.h"
@@ -53,7 +57,8 @@ AGASHeroCharacter::AGASHeroCharacter(const class FObjectInitializer& ObjectIniti
 
 	AIControllerClass = AGASHeroAIController::StaticClass();
 
-	DeadTag = FGameplayTag::RequestGameplayTag(FName("State.Dead"));
+	// The ASC lives on the PlayerState, so abilities are given once per PlayerState and kept through respawns
+	bKeepAbilitiesOnDeath = true;
 }
 
 // Called to bind functionality to input
@@ -70,6 +75,8 @@ void AGASHeroCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCo
 	PlayerInputComponent->BindAxis("TurnRate", this, &AGASHeroCharacter::TurnRate);
 
 	// Bind player input to the AbilitySystemComponent. Also called in OnRep_PlayerState because of a potential race condition.
+	// This is a new InputComponent when a reused hero is possessed again after respawning, so it has to be bound again.
+	ASCInputBound = false;
 	BindASCInput();
 }
 
@@ -87,6 +94,8 @@ void AGASHeroCharacter::PossessedBy(AController * NewController)
 		// AI won't have PlayerControllers so we can init again here just to be sure. No harm in initing twice for heroes that have PlayerControllers.
 		PS->GetAbilitySystemComponent()->InitAbilityActorInfo(PS, this);
 
+		BindMovementToAbilitySystem();
+
 		// Set the AttributeSetBase for convenience attribute functions
 		AttributeSetBase = PS->GetAttributeSetBase();
 
@@ -97,8 +106,9 @@ void AGASHeroCharacter::PossessedBy(AController * NewController)
 		
 		// Respawn specific things that won't affect first possession.
 
-		// Forcibly set the DeadTag count to 0
-		AbilitySystemComponent->SetTagMapCount(DeadTag, 0);
+		// Forcibly set the DeadTag count to 0, here and on clients
+		AbilitySystemComponent->SetTagMapCount(FGASGameplayTags::Get().State_Dead, 0);
+		AbilitySystemComponent->SetReplicatedLooseGameplayTagCount(FGASGameplayTags::Get().State_Dead, 0);
 
 		// Set Health/Mana/Stamina to their max. This is only necessary for *Respawn*.
 		SetHealth(GetMaxHealth());
@@ -112,6 +122,8 @@ void AGASHeroCharacter::PossessedBy(AController * NewController)
 
 		AddCharacterAbilities();
 
+		BindNetDormancyToAbilitySystem();
+
 		AGASPlayerController* PC = Cast<AGASPlayerController>(GetController());
 		if (PC)
 		{
@@ -122,6 +134,11 @@ void AGASHeroCharacter::PossessedBy(AController * NewController)
 	}
 }
 
+void AGASHeroCharacter::ReinitializeAbilitySystem()
+{
+	// Reused heroes are possessed again right after reactivation and PossessedBy() does all of this
+}
+
 USpringArmComponent * AGASHeroCharacter::GetCameraBoom()
 {
 	return CameraBoom;
@@ -152,6 +169,39 @@ USkeletalMeshComponent * AGASHeroCharacter::GetGunComponent() const
 	return GunComponent;
 }
 
+FTransform AGASHeroCharacter::GetMuzzleTransform()
+{
+	static const FName MuzzleSocketName(TEXT("Muzzle"));
+
+	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
+	UAnimMontage* Montage = AnimInstance ? AnimInstance->GetCurrentActiveMontage() : nullptr;
+	UGASMontageCacheSubsystem* MontageCache = GetWorld()->GetSubsystem<UGASMontageCacheSubsystem>();
+	if (!Montage || !MontageCache || !UGASAnimNotify_GameplayEvent::UseServerMontageEvents(this))
+	{
+		return GunComponent->GetSocketTransform(MuzzleSocketName);
+	}
+
+	// Montages tick on dedicated servers, only the pose isn't evaluated. Sample the offset track at 30 fps.
+	FGASMuzzleOffsetKey Key;
+	Key.CharacterClass = FObjectKey(GetClass());
+	Key.Mesh = FObjectKey(GetMesh()->GetSkeletalMeshAsset());
+	Key.Gun = FObjectKey(GunComponent->GetSkeletalMeshAsset());
+	Key.Montage = FObjectKey(Montage);
+	Key.Frame = FMath::RoundToInt(AnimInstance->Montage_GetPosition(Montage) * 30.0f);
+
+	if (const FTransform* MuzzleOffset = MontageCache->FindMuzzleOffset(Key))
+	{
+		return *MuzzleOffset * GetActorTransform();
+	}
+
+	// First time this frame of the montage is needed, evaluate the pose once. The gun is attached to the mesh so it moves with it.
+	GetMesh()->RefreshBoneTransforms();
+	const FTransform MuzzleTransform = GunComponent->GetSocketTransform(MuzzleSocketName);
+	MontageCache->AddMuzzleOffset(Key, MuzzleTransform.GetRelativeTransform(GetActorTransform()));
+
+	return MuzzleTransform;
+}
+
 void AGASHeroCharacter::FinishDying()
 {
 	if (GetLocalRole() == ROLE_Authority)
@@ -161,6 +211,10 @@ void AGASHeroCharacter::FinishDying()
 		if (GM)
 		{
 			GM->HeroDied(GetController());
+
+			// The GameMode keeps this hero and reactivates it on respawn
+			DeactivateCharacter();
+			return;
 		}
 	}
 
@@ -183,6 +237,13 @@ void AGASHeroCharacter::BeginPlay()
 
 	StartingCameraBoomArmLength = CameraBoom->TargetArmLength;
 	StartingCameraBoomLocation = CameraBoom->GetRelativeLocation();
+
+	// Montage gameplay events come from timers and the muzzle from GetMuzzleTransform(), so the pose doesn't need to be evaluated.
+	// Montages still tick so their blend out and end callbacks fire.
+	if (UGASAnimNotify_GameplayEvent::UseServerMontageEvents(this))
+	{
+		GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	}
 }
 
 void AGASHeroCharacter::PostInitializeComponents()
@@ -278,6 +339,8 @@ void AGASHeroCharacter::OnRep_PlayerState()
 		// Init ASC Actor Info for clients. Server will init its ASC when it possesses a new Actor.
 		AbilitySystemComponent->InitAbilityActorInfo(PS, this);
 
+		BindMovementToAbilitySystem();
+
 		// Bind player input to the AbilitySystemComponent. Also called in SetupPlayerInputComponent because of a potential race condition.
 		BindASCInput();
 
@@ -301,7 +364,7 @@ void AGASHeroCharacter::OnRep_PlayerState()
 		// Respawn specific things that won't affect first possession.
 
 		// Forcibly set the DeadTag count to 0
-		AbilitySystemComponent->SetTagMapCount(DeadTag, 0);
+		AbilitySystemComponent->SetTagMapCount(FGASGameplayTags::Get().State_Dead, 0);
 
 		// Set Health/Mana/Stamina to their max. This is only necessary for *Respawn*.
 		SetHealth(GetMaxHealth());
@@ -6,6 +6,8 @@
 #include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/WidgetComponent.h"
+#include "GASGameplayTags.h"
+#include "GASMinionPoolSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "UI/GASFloatingStatusBarWidget.h"
 
@@ -44,6 +46,30 @@ AGASMinionCharacter::AGASMinionCharacter(const class FObjectInitializer& ObjectI
 	}
 }
 
+float AGASMinionCharacter::GetXPBounty() const
+{
+	return XPBounty.GetValueAtLevel(GetCharacterLevel());
+}
+
+float AGASMinionCharacter::GetGoldBounty() const
+{
+	return GoldBounty.GetValueAtLevel(GetCharacterLevel());
+}
+
+void AGASMinionCharacter::FinishDying()
+{
+	if (HasAuthority())
+	{
+		UGASMinionPoolSubsystem* MinionPool = GetWorld()->GetSubsystem<UGASMinionPoolSubsystem>();
+		if (MinionPool && MinionPool->ReleaseMinion(this))
+		{
+			return;
+		}
+	}
+
+	Super::FinishDying();
+}
+
 void AGASMinionCharacter::BeginPlay()
 {
 	Super::BeginPlay();
@@ -51,6 +77,7 @@ void AGASMinionCharacter::BeginPlay()
 	if (AbilitySystemComponent.IsValid())
 	{
 		AbilitySystemComponent->InitAbilityActorInfo(this, this);
+		BindMovementToAbilitySystem();
 		InitializeAttributes();
 		AddStartupEffects();
 		AddCharacterAbilities();
@@ -78,7 +105,9 @@ void AGASMinionCharacter::BeginPlay()
 		HealthChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetHealthAttribute()).AddUObject(this, &AGASMinionCharacter::HealthChanged);
 
 		// Tag change callbacks
-		AbilitySystemComponent->RegisterGameplayTagEvent(FGameplayTag::RequestGameplayTag(FName("State.Debuff.Stun")), EGameplayTagEventType::NewOrRemoved).AddUObject(this, &AGASMinionCharacter::StunTagChanged);
+		AbilitySystemComponent->RegisterGameplayTagEvent(FGASGameplayTags::Get().State_Debuff_Stun, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &AGASMinionCharacter::StunTagChanged);
+
+		BindNetDormancyToAbilitySystem();
 	}
 }
 
@@ -93,7 +122,7 @@ void AGASMinionCharacter::HealthChanged(const FOnAttributeChangeData & Data)
 	}
 
 	// If the minion died, handle death
-	if (!IsAlive() && !AbilitySystemComponent->HasMatchingGameplayTag(DeadTag))
+	if (!IsAlive() && !AbilitySystemComponent->HasMatchingGameplayTag(FGASGameplayTags::Get().State_Dead))
 	{
 		Die();
 	}
@@ -103,11 +132,13 @@ void AGASMinionCharacter::StunTagChanged(const FGameplayTag CallbackTag, int32 N
 {
 	if (NewCount > 0)
 	{
+		const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
 		FGameplayTagContainer AbilityTagsToCancel;
-		AbilityTagsToCancel.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability")));
+		AbilityTagsToCancel.AddTag(GameplayTags.Ability);
 
 		FGameplayTagContainer AbilityTagsToIgnore;
-		AbilityTagsToIgnore.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.NotCanceledByStun")));
+		AbilityTagsToIgnore.AddTag(GameplayTags.Ability_NotCanceledByStun);
 
 		AbilitySystemComponent->CancelAbilities(&AbilityTagsToCancel, &AbilityTagsToIgnore);
 	}
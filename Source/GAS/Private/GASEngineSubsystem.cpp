@@ -3,8 +3,11 @@
 
 #include "GASEngineSubsystem.h"
 #include "AbilitySystemGlobals.h"
+#include "GASGameplayTags.h"
 
 void UGASEngineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	FGASGameplayTags::InitializeNativeTags();
 }
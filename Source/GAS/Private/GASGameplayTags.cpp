@@ -0,0 +1,40 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASGameplayTags.h"
+#include "GameplayTagsManager.h"
+
+FGASGameplayTags FGASGameplayTags::GameplayTags;
+
+void FGASGameplayTags::InitializeNativeTags()
+{
+	GameplayTags.AddAllTags();
+}
+
+void FGASGameplayTags::AddAllTags()
+{
+	AddTag(Ability, "Ability");
+	AddTag(Ability_NotCanceledByStun, "Ability.NotCanceledByStun");
+
+	AddTag(Data_Damage, "Data.Damage");
+
+	AddTag(Effect_RemoveOnDeath, "Effect.RemoveOnDeath");
+
+	AddTag(Event_Montage_EndAbility, "Event.Montage.EndAbility");
+	AddTag(Event_Montage_SpawnProjectile, "Event.Montage.SpawnProjectile");
+
+	AddTag(State_AimDownSights, "State.AimDownSights");
+	AddTag(State_AimDownSights_Removal, "State.AimDownSights.Removal");
+	AddTag(State_Dead, "State.Dead");
+	AddTag(State_Debuff_Stun, "State.Debuff.Stun");
+}
+
+void FGASGameplayTags::AddTag(FGameplayTag& OutTag, const ANSICHAR* TagName)
+{
+	OutTag = UGameplayTagsManager::Get().RequestGameplayTag(FName(TagName), false);
+
+	if (!OutTag.IsValid())
+	{
+		UE_LOG(LogTemp, Fatal, TEXT("%s() Native gameplay tag %s is missing from the gameplay tag table."), *FString(__FUNCTION__), ANSI_TO_TCHAR(TagName));
+	}
+}
@@ -0,0 +1,373 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASLagCompensationSubsystem.h"
+#include "Characters/GASCharacterMain.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState.h"
+#include "GAS.h"
+
+DECLARE_CYCLE_STAT(TEXT("GAS Lag Compensation Record"), STAT_GASLagCompensationRecord, STATGROUP_GAS);
+DECLARE_CYCLE_STAT(TEXT("GAS Lag Compensation Rewind"), STAT_GASLagCompensationRewind, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Lag Compensated Characters"), STAT_GASLagCompensatedCharacters, STATGROUP_GAS);
+
+namespace GASLagCompensation
+{
+	// About one second of history at 60Hz
+	const int32 HistorySize = 64;
+
+	float MaxRewindTime = 0.25f;
+	static FAutoConsoleVariableRef CVarMaxRewindTime(
+		TEXT("GAS.LagCompensation.MaxRewindTime"),
+		MaxRewindTime,
+		TEXT("Longest time in seconds that hits are rewound for a client's ping."),
+		ECVF_Default);
+}
+
+void FGASCapsuleSnapshot::SetNum(int32 NumSlots)
+{
+	X.SetNumUninitialized(NumSlots, false);
+	Y.SetNumUninitialized(NumSlots, false);
+	Z.SetNumUninitialized(NumSlots, false);
+	Radius.SetNumUninitialized(NumSlots, false);
+	HalfHeight.SetNumUninitialized(NumSlots, false);
+}
+
+void UGASLagCompensationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	History.SetNum(GASLagCompensation::HistorySize);
+}
+
+void UGASLagCompensationSubsystem::Deinitialize()
+{
+	History.Empty();
+	SlotCharacters.Empty();
+	FreeSlots.Empty();
+	CharacterSlots.Empty();
+	NumSnapshots = 0;
+	NextSnapshot = 0;
+
+	Super::Deinitialize();
+}
+
+void UGASLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	RecordSnapshot();
+}
+
+TStatId UGASLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+bool UGASLagCompensationSubsystem::IsTickable() const
+{
+	// Hits are only validated on the Server
+	return GetWorld() && GetWorld()->GetNetMode() != NM_Client && CharacterSlots.Num() > 0;
+}
+
+void UGASLagCompensationSubsystem::RegisterCharacter(AGASCharacterMain* Character)
+{
+	if (!Character || CharacterSlots.Contains(Character))
+	{
+		return;
+	}
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(false);
+		SlotCharacters[Slot] = Character;
+
+		// The history still holds the previous character of this slot
+		for (FGASCapsuleSnapshot& Snapshot : History)
+		{
+			if (Snapshot.Num() > Slot)
+			{
+				Snapshot.Radius[Slot] = 0.0f;
+			}
+		}
+	}
+	else
+	{
+		Slot = SlotCharacters.Add(Character);
+	}
+
+	CharacterSlots.Add(Character, Slot);
+}
+
+void UGASLagCompensationSubsystem::UnregisterCharacter(AGASCharacterMain* Character)
+{
+	int32 Slot;
+	if (CharacterSlots.RemoveAndCopyValue(Character, Slot))
+	{
+		SlotCharacters[Slot] = nullptr;
+		FreeSlots.Add(Slot);
+	}
+}
+
+double UGASLagCompensationSubsystem::GetRewindTime(const AActor* Instigator) const
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	const APawn* Pawn = Cast<APawn>(Instigator);
+	if (!Pawn && Instigator)
+	{
+		Pawn = Instigator->GetInstigator();
+	}
+
+	const APlayerState* PlayerState = Pawn && Pawn->IsPlayerControlled() ? Pawn->GetPlayerState() : nullptr;
+	if (!PlayerState)
+	{
+		return Now;
+	}
+
+	// The client acted on what it saw about one round trip ago
+	const float Ping = PlayerState->GetPingInMilliseconds() * 0.001f;
+	return Now - FMath::Clamp(Ping, 0.0f, GASLagCompensation::MaxRewindTime);
+}
+
+bool UGASLagCompensationSubsystem::RewindTrace(const FVector& Start, const FVector& End, float SweepRadius, double Time, int32 IgnoreSlot, FGASRewindHit& OutHit) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASLagCompensationRewind);
+
+	const FGASCapsuleSnapshot* Older;
+	const FGASCapsuleSnapshot* Newer;
+	float Alpha;
+	if (!FindSnapshots(Time, Older, Newer, Alpha))
+	{
+		return false;
+	}
+
+	const int32 NumSlots = FMath::Min(Older->Num(), Newer->Num());
+
+	// Broad phase against each capsule's bounding sphere, relative to Start. Plain float math over the contiguous
+	// snapshot arrays that writes one mask byte per slot, without branches or early outs, so the compiler can vectorize it.
+	const FVector3f Delta(End - Start);
+	const float DeltaSizeSquared = Delta.SizeSquared();
+	const float InvDeltaSizeSquared = DeltaSizeSquared > UE_SMALL_NUMBER ? 1.0f / DeltaSizeSquared : 0.0f;
+	const float StartX = Start.X;
+	const float StartY = Start.Y;
+	const float StartZ = Start.Z;
+
+	TArray<uint8, TInlineAllocator<64>> Overlaps;
+	Overlaps.SetNumUninitialized(NumSlots);
+	for (int32 Slot = 0; Slot < NumSlots; Slot++)
+	{
+		const float CenterX = FMath::Lerp(Older->X[Slot], Newer->X[Slot], Alpha) - StartX;
+		const float CenterY = FMath::Lerp(Older->Y[Slot], Newer->Y[Slot], Alpha) - StartY;
+		const float CenterZ = FMath::Lerp(Older->Z[Slot], Newer->Z[Slot], Alpha) - StartZ;
+
+		const float T = FMath::Clamp((CenterX * Delta.X + CenterY * Delta.Y + CenterZ * Delta.Z) * InvDeltaSizeSquared, 0.0f, 1.0f);
+		const float OffsetX = CenterX - Delta.X * T;
+		const float OffsetY = CenterY - Delta.Y * T;
+		const float OffsetZ = CenterZ - Delta.Z * T;
+
+		// Half height includes the hemispheres, so it is the bounding sphere radius
+		const float Bound = Newer->HalfHeight[Slot] + SweepRadius;
+		const bool bValid = Older->Radius[Slot] > 0.0f && Newer->Radius[Slot] > 0.0f;
+
+		Overlaps[Slot] = bValid & (OffsetX * OffsetX + OffsetY * OffsetY + OffsetZ * OffsetZ <= Bound * Bound);
+	}
+
+	// Narrow phase, segment against the capsule axis
+	bool bHit = false;
+
+	for (int32 Slot = 0; Slot < NumSlots; Slot++)
+	{
+		if (!Overlaps[Slot] || Slot == IgnoreSlot)
+		{
+			continue;
+		}
+
+		const FVector Center(
+			FMath::Lerp(Older->X[Slot], Newer->X[Slot], Alpha),
+			FMath::Lerp(Older->Y[Slot], Newer->Y[Slot], Alpha),
+			FMath::Lerp(Older->Z[Slot], Newer->Z[Slot], Alpha));
+
+		float HitTime;
+		FVector Location;
+		FVector Normal;
+		if (!SweepCapsule(Start, End, SweepRadius, Center, Newer->Radius[Slot], Newer->HalfHeight[Slot], HitTime, Location, Normal) || (bHit && HitTime >= OutHit.Time))
+		{
+			continue;
+		}
+
+		bHit = true;
+		OutHit.Slot = Slot;
+		OutHit.Time = HitTime;
+		OutHit.Location = Location;
+		OutHit.Normal = Normal;
+	}
+
+	return bHit;
+}
+
+bool UGASLagCompensationSubsystem::ValidateHit(AGASCharacterMain* Target, FVector Location, double Time, float Tolerance) const
+{
+	const int32 Slot = GetCharacterSlot(Target);
+
+	const FGASCapsuleSnapshot* Older;
+	const FGASCapsuleSnapshot* Newer;
+	float Alpha;
+	if (Slot == INDEX_NONE || !FindSnapshots(Time, Older, Newer, Alpha))
+	{
+		// Nothing recorded to rewind to
+		return ValidateLiveHit(Target, Location, Tolerance);
+	}
+
+	if (Older->Num() <= Slot || Newer->Num() <= Slot || Older->Radius[Slot] <= 0.0f || Newer->Radius[Slot] <= 0.0f)
+	{
+		// Registered but dead or not spawned yet at Time
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_GASLagCompensationRewind);
+
+	const FVector Center(
+		FMath::Lerp(Older->X[Slot], Newer->X[Slot], Alpha),
+		FMath::Lerp(Older->Y[Slot], Newer->Y[Slot], Alpha),
+		FMath::Lerp(Older->Z[Slot], Newer->Z[Slot], Alpha));
+
+	return IsNearCapsule(Location, Center, Newer->Radius[Slot], Newer->HalfHeight[Slot], Tolerance);
+}
+
+bool UGASLagCompensationSubsystem::ValidateLiveHit(const AGASCharacterMain* Target, const FVector& Location, float Tolerance)
+{
+	const UCapsuleComponent* Capsule = Target ? Target->GetCapsuleComponent() : nullptr;
+	if (!Capsule || !Target->IsAlive())
+	{
+		return false;
+	}
+
+	return IsNearCapsule(Location, Capsule->GetComponentLocation(), Capsule->GetScaledCapsuleRadius(), Capsule->GetScaledCapsuleHalfHeight(), Tolerance);
+}
+
+bool UGASLagCompensationSubsystem::SweepCapsule(const FVector& Start, const FVector& End, float SweepRadius, const FVector& Center, float Radius, float HalfHeight,
+	float& OutTime, FVector& OutLocation, FVector& OutNormal)
+{
+	const FVector AxisExtent(0.0f, 0.0f, FMath::Max(HalfHeight - Radius, 0.0f));
+
+	FVector PointOnTrace;
+	FVector PointOnAxis;
+	FMath::SegmentDistToSegmentSafe(Start, End, Center - AxisExtent, Center + AxisExtent, PointOnTrace, PointOnAxis);
+
+	const double HitDistance = Radius + SweepRadius;
+	const double DistanceSquared = FVector::DistSquared(PointOnTrace, PointOnAxis);
+	if (DistanceSquared > HitDistance * HitDistance)
+	{
+		return false;
+	}
+
+	// Back off from the closest approach to where the sweep first touches the capsule
+	const FVector TraceDelta = End - Start;
+	const double TraceLength = TraceDelta.Size();
+	double HitTime = 0.0;
+	if (TraceLength > UE_SMALL_NUMBER)
+	{
+		const double ClosestTime = FVector::Dist(Start, PointOnTrace) / TraceLength;
+		HitTime = FMath::Max(ClosestTime - FMath::Sqrt(HitDistance * HitDistance - DistanceSquared) / TraceLength, 0.0);
+	}
+
+	OutTime = static_cast<float>(HitTime);
+	OutLocation = Start + TraceDelta * HitTime;
+	OutNormal = (OutLocation - FMath::ClosestPointOnSegment(OutLocation, Center - AxisExtent, Center + AxisExtent)).GetSafeNormal();
+	return true;
+}
+
+bool UGASLagCompensationSubsystem::IsNearCapsule(const FVector& Location, const FVector& Center, float Radius, float HalfHeight, float Tolerance)
+{
+	const FVector AxisExtent(0.0f, 0.0f, FMath::Max(HalfHeight - Radius, 0.0f));
+	return FMath::PointDistToSegment(Location, Center - AxisExtent, Center + AxisExtent) <= Radius + Tolerance;
+}
+
+int32 UGASLagCompensationSubsystem::GetCharacterSlot(const AActor* Character) const
+{
+	const int32* Slot = CharacterSlots.Find(Character);
+	return Slot ? *Slot : INDEX_NONE;
+}
+
+AGASCharacterMain* UGASLagCompensationSubsystem::GetCharacterInSlot(int32 Slot) const
+{
+	return SlotCharacters.IsValidIndex(Slot) ? SlotCharacters[Slot].Get() : nullptr;
+}
+
+bool UGASLagCompensationSubsystem::HasHistory() const
+{
+	return NumSnapshots > 0;
+}
+
+bool UGASLagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGASLagCompensationSubsystem::RecordSnapshot()
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASLagCompensationRecord);
+
+	FGASCapsuleSnapshot& Snapshot = History[NextSnapshot];
+	Snapshot.Time = GetWorld()->GetTimeSeconds();
+	Snapshot.SetNum(SlotCharacters.Num());
+
+	for (int32 Slot = 0; Slot < SlotCharacters.Num(); Slot++)
+	{
+		const AGASCharacterMain* Character = SlotCharacters[Slot].Get();
+		const UCapsuleComponent* Capsule = Character ? Character->GetCapsuleComponent() : nullptr;
+		if (!Capsule || !Character->IsCharacterActive() || !Character->IsAlive())
+		{
+			Snapshot.X[Slot] = Snapshot.Y[Slot] = Snapshot.Z[Slot] = 0.0f;
+			Snapshot.Radius[Slot] = Snapshot.HalfHeight[Slot] = 0.0f;
+			continue;
+		}
+
+		const FVector Center = Capsule->GetComponentLocation();
+		Snapshot.X[Slot] = Center.X;
+		Snapshot.Y[Slot] = Center.Y;
+		Snapshot.Z[Slot] = Center.Z;
+		Snapshot.Radius[Slot] = Capsule->GetScaledCapsuleRadius();
+		Snapshot.HalfHeight[Slot] = Capsule->GetScaledCapsuleHalfHeight();
+	}
+
+	NextSnapshot = (NextSnapshot + 1) % History.Num();
+	NumSnapshots = FMath::Min(NumSnapshots + 1, History.Num());
+
+	SET_DWORD_STAT(STAT_GASLagCompensatedCharacters, CharacterSlots.Num());
+}
+
+bool UGASLagCompensationSubsystem::FindSnapshots(double Time, const FGASCapsuleSnapshot*& OutOlder, const FGASCapsuleSnapshot*& OutNewer, float& OutAlpha) const
+{
+	if (NumSnapshots == 0)
+	{
+		return false;
+	}
+
+	const int32 HistoryNum = History.Num();
+	const int32 Newest = (NextSnapshot - 1 + HistoryNum) % HistoryNum;
+
+	OutNewer = &History[Newest];
+	OutOlder = OutNewer;
+	OutAlpha = 0.0f;
+
+	// Newest first, most rewinds are only a few frames back
+	for (int32 Age = 0; Age < NumSnapshots; Age++)
+	{
+		const FGASCapsuleSnapshot& Snapshot = History[(Newest - Age + HistoryNum) % HistoryNum];
+		if (Snapshot.Time <= Time)
+		{
+			OutOlder = &Snapshot;
+			const double Span = OutNewer->Time - OutOlder->Time;
+			OutAlpha = Span > 0.0 ? FMath::Clamp(static_cast<float>((Time - OutOlder->Time) / Span), 0.0f, 1.0f) : 0.0f;
+			return true;
+		}
+
+		OutNewer = &Snapshot;
+	}
+
+	// Older than the whole history, use the oldest snapshot
+	OutOlder = OutNewer;
+	return true;
+}
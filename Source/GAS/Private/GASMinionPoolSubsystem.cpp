@@ -0,0 +1,104 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASMinionPoolSubsystem.h"
+#include "Characters/Minions/GASMinionCharacter.h"
+#include "GAS.h"
+
+DECLARE_CYCLE_STAT(TEXT("GAS Minion Pool Spawn"), STAT_GASMinionPoolSpawn, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Minions Reused"), STAT_GASMinionsReused, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Minions Spawned"), STAT_GASMinionsSpawned, STATGROUP_GAS);
+
+void UGASMinionPoolSubsystem::Deinitialize()
+{
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+AGASMinionCharacter* UGASMinionPoolSubsystem::SpawnMinion(TSubclassOf<AGASMinionCharacter> MinionClass, const FTransform& SpawnTransform)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASMinionPoolSpawn);
+
+	UWorld* World = GetWorld();
+	if (!MinionClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	FGASMinionPool* Pool = Pools.Find(MinionClass);
+	while (Pool && Pool->Minions.Num() > 0)
+	{
+		AGASMinionCharacter* Minion = Pool->Minions.Pop(false);
+		if (IsValid(Minion))
+		{
+			INC_DWORD_STAT(STAT_GASMinionsReused);
+			Minion->ReactivateCharacter(SpawnTransform);
+			return Minion;
+		}
+	}
+
+	return SpawnNewMinion(MinionClass, SpawnTransform);
+}
+
+bool UGASMinionPoolSubsystem::ReleaseMinion(AGASMinionCharacter* Minion)
+{
+	if (!IsValid(Minion) || !Minion->HasAuthority())
+	{
+		return false;
+	}
+
+	FGASMinionPool& Pool = Pools.FindOrAdd(Minion->GetClass());
+	if (Pool.Minions.Contains(Minion))
+	{
+		return true;
+	}
+
+	if (Pool.Minions.Num() >= MaxPooledMinionsPerClass)
+	{
+		return false;
+	}
+
+	Minion->DeactivateCharacter();
+	Pool.Minions.Add(Minion);
+	return true;
+}
+
+void UGASMinionPoolSubsystem::Prewarm(TSubclassOf<AGASMinionCharacter> MinionClass, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!MinionClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		AGASMinionCharacter* Minion = SpawnNewMinion(MinionClass, FTransform::Identity);
+		if (Minion)
+		{
+			ReleaseMinion(Minion);
+		}
+	}
+}
+
+int32 UGASMinionPoolSubsystem::GetNumPooledMinions(TSubclassOf<AGASMinionCharacter> MinionClass) const
+{
+	const FGASMinionPool* Pool = Pools.Find(MinionClass);
+	return Pool ? Pool->Minions.Num() : 0;
+}
+
+bool UGASMinionPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AGASMinionCharacter* UGASMinionPoolSubsystem::SpawnNewMinion(TSubclassOf<AGASMinionCharacter> MinionClass, const FTransform& SpawnTransform)
+{
+	INC_DWORD_STAT(STAT_GASMinionsSpawned);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	return GetWorld()->SpawnActor<AGASMinionCharacter>(MinionClass, SpawnTransform, SpawnParameters);
+}
@@ -0,0 +1,72 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASMontageCacheSubsystem.h"
+#include "Animation/AnimationAsset.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/SkeletalMesh.h"
+
+void UGASMontageCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UGASMontageCacheSubsystem::OnObjectPropertyChanged);
+#endif
+}
+
+void UGASMontageCacheSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
+
+	Reset();
+
+	Super::Deinitialize();
+}
+
+const TArray<FGASMontageGameplayEvent>& UGASMontageCacheSubsystem::GetMontageEvents(const UAnimMontage* Montage)
+{
+	TArray<FGASMontageGameplayEvent>* Events = MontageEvents.Find(FObjectKey(Montage));
+	if (Events)
+	{
+		return *Events;
+	}
+
+	TArray<FGASMontageGameplayEvent>& NewEvents = MontageEvents.Add(FObjectKey(Montage));
+	UGASAnimNotify_GameplayEvent::GatherMontageEvents(Montage, NewEvents);
+	return NewEvents;
+}
+
+const FTransform* UGASMontageCacheSubsystem::FindMuzzleOffset(const FGASMuzzleOffsetKey& Key) const
+{
+	return MuzzleOffsets.Find(Key);
+}
+
+void UGASMontageCacheSubsystem::AddMuzzleOffset(const FGASMuzzleOffsetKey& Key, const FTransform& MuzzleOffset)
+{
+	MuzzleOffsets.Add(Key, MuzzleOffset);
+}
+
+void UGASMontageCacheSubsystem::Reset()
+{
+	MontageEvents.Empty();
+	MuzzleOffsets.Empty();
+}
+
+bool UGASMontageCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+#if WITH_EDITOR
+void UGASMontageCacheSubsystem::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Notify times and poses may have moved. Rare enough to drop everything.
+	if (Object && (Object->IsA<UAnimationAsset>() || Object->IsA<USkeletalMesh>()))
+	{
+		Reset();
+	}
+}
+#endif
@@ -0,0 +1,579 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASProjectileSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Async/ParallelFor.h"
+#include "Characters/GASCharacterMain.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "GAS.h"
+#include "Player/GASPlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("GAS Projectile Simulation"), STAT_GASProjectileTick, STATGROUP_GAS);
+DECLARE_CYCLE_STAT(TEXT("GAS Projectile Sweeps"), STAT_GASProjectileSweeps, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Live Projectiles"), STAT_GASLiveProjectiles, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Predicted Projectiles"), STAT_GASPredictedProjectiles, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Predicted Projectiles Reconciled"), STAT_GASPredictedProjectilesReconciled, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Predicted Projectiles Rejected"), STAT_GASPredictedProjectilesRejected, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Projectile Actors Reused"), STAT_GASProjectileActorsReused, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Projectile Actors Spawned"), STAT_GASProjectileActorsSpawned, STATGROUP_GAS);
+
+namespace GASProjectiles
+{
+	int32 ParallelThreshold = 64;
+	static FAutoConsoleVariableRef CVarParallelThreshold(
+		TEXT("GAS.ProjectileParallelThreshold"),
+		ParallelThreshold,
+		TEXT("Number of simulated projectiles from which their movement and sweeps run in a ParallelFor."),
+		ECVF_Default);
+}
+
+void UGASProjectileSubsystem::Deinitialize()
+{
+	Locations.Empty();
+	Velocities.Empty();
+	RemainingRanges.Empty();
+	TypeIndices.Empty();
+	ProjectileIds.Empty();
+	Instigators.Empty();
+	PredictionKeys.Empty();
+	RecentPredictionKeys.Empty();
+	DamageSpecs.Empty();
+	RewindOffsets.Empty();
+	PendingSpawns.Empty();
+	ConnectionSpawns.Empty();
+	Types.Empty();
+	ActorPools.Empty();
+
+	if (IsValid(VisualsActor))
+	{
+		VisualsActor->Destroy();
+	}
+
+	VisualsActor = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UGASProjectileSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASProjectileTick);
+
+	SendPendingSpawns();
+
+	SimulateProjectiles(DeltaTime);
+
+	if (GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		UpdateVisuals();
+	}
+
+	SET_DWORD_STAT(STAT_GASLiveProjectiles, Locations.Num());
+}
+
+TStatId UGASProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASProjectileSubsystem, STATGROUP_Tickables);
+}
+
+uint32 UGASProjectileSubsystem::FireProjectile(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, float Range, const FGameplayEffectSpecHandle& DamageEffectSpecHandle, AGASCharacterMain* Instigator, int16 PredictionKey)
+{
+	FVector Velocity;
+	if (GetWorld()->GetNetMode() == NM_Client || !GetProjectileVelocity(ProjectileClass, SpawnTransform, Velocity))
+	{
+		return 0;
+	}
+
+	const uint32 ProjectileId = NextProjectileId++;
+	if (NextProjectileId == 0)
+	{
+		NextProjectileId = 1;
+	}
+
+	AddProjectile(FindOrAddType(ProjectileClass), SpawnTransform.GetLocation(), Velocity, Range, ProjectileId, Instigator, DamageEffectSpecHandle);
+
+	UGASLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UGASLagCompensationSubsystem>();
+	if (LagCompensation)
+	{
+		RewindOffsets.Last() = static_cast<float>(GetWorld()->GetTimeSeconds() - LagCompensation->GetRewindTime(Instigator));
+	}
+
+	FGASProjectileSpawn& Spawn = PendingSpawns.AddDefaulted_GetRef();
+	Spawn.ProjectileClass = ProjectileClass;
+	Spawn.Instigator = Instigator;
+	Spawn.Origin = SpawnTransform.GetLocation();
+	Spawn.Velocity = Velocity;
+	Spawn.Range = Range;
+	Spawn.ProjectileId = ProjectileId;
+	Spawn.PredictionKey = PredictionKey;
+
+	return ProjectileId;
+}
+
+void UGASProjectileSubsystem::FirePredictedProjectile(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, float Range, AGASCharacterMain* Instigator, FPredictionKey PredictionKey)
+{
+	FVector Velocity;
+	if (GetWorld()->GetNetMode() != NM_Client || !PredictionKey.IsValidKey() || !GetProjectileVelocity(ProjectileClass, SpawnTransform, Velocity))
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_GASPredictedProjectiles);
+
+	AddProjectile(FindOrAddType(ProjectileClass), SpawnTransform.GetLocation(), Velocity, Range, 0, Instigator, FGameplayEffectSpecHandle(), PredictionKey.Current);
+
+	const int32 MaxRecentPredictionKeys = 32;
+	if (RecentPredictionKeys.Num() < MaxRecentPredictionKeys)
+	{
+		RecentPredictionKeys.Add(PredictionKey.Current);
+	}
+	else
+	{
+		RecentPredictionKeys[NextRecentPredictionKey] = PredictionKey.Current;
+		NextRecentPredictionKey = (NextRecentPredictionKey + 1) % MaxRecentPredictionKeys;
+	}
+
+	PredictionKey.NewRejectedDelegate().BindUObject(this, &UGASProjectileSubsystem::OnPredictionKeyRejected, PredictionKey.Current);
+}
+
+void UGASProjectileSubsystem::AddSimulatedProjectiles(const TArray<FGASProjectileSpawn>& Spawns)
+{
+	for (const FGASProjectileSpawn& Spawn : Spawns)
+	{
+		if (!Spawn.ProjectileClass)
+		{
+			continue;
+		}
+
+		AGASCharacterMain* Instigator = Spawn.Instigator;
+
+		if (Spawn.PredictionKey != 0 && Instigator && Instigator->IsLocallyControlled())
+		{
+			// Our own shot. Either the predicted projectile is still flying, or it already hit something and this one shouldn't show up again.
+			if (ReconcilePredictedProjectile(Spawn, Instigator) || RecentPredictionKeys.Contains(Spawn.PredictionKey))
+			{
+				continue;
+			}
+		}
+
+		AddProjectile(FindOrAddType(Spawn.ProjectileClass), Spawn.Origin, Spawn.Velocity, Spawn.Range, Spawn.ProjectileId, Instigator, FGameplayEffectSpecHandle());
+	}
+}
+
+int32 UGASProjectileSubsystem::GetNumProjectiles() const
+{
+	return Locations.Num();
+}
+
+AGASProjectile* UGASProjectileSubsystem::SpawnProjectileActor(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, float Range, const FGameplayEffectSpecHandle& DamageEffectSpecHandle, AActor* Owner, APawn* Instigator)
+{
+	if (!ProjectileClass || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	FGASProjectileActorPool* Pool = ActorPools.Find(ProjectileClass);
+	while (Pool && Pool->Projectiles.Num() > 0)
+	{
+		AGASProjectile* Projectile = Pool->Projectiles.Pop(false);
+		if (IsValid(Projectile))
+		{
+			INC_DWORD_STAT(STAT_GASProjectileActorsReused);
+			Projectile->SetOwner(Owner);
+			Projectile->SetInstigator(Instigator);
+			Projectile->ActivateFromPool(SpawnTransform, Range, DamageEffectSpecHandle);
+			return Projectile;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_GASProjectileActorsSpawned);
+
+	AGASProjectile* Projectile = GetWorld()->SpawnActorDeferred<AGASProjectile>(ProjectileClass, SpawnTransform, Owner, Instigator, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (Projectile)
+	{
+		Projectile->DamageEffectSpecHandle = DamageEffectSpecHandle;
+		Projectile->Range = Range;
+		Projectile->bPooled = true;
+		Projectile->FinishSpawning(SpawnTransform);
+	}
+
+	return Projectile;
+}
+
+void UGASProjectileSubsystem::ReleaseProjectileActor(AGASProjectile* Projectile)
+{
+	if (!IsValid(Projectile) || !Projectile->HasAuthority() || !Projectile->IsActiveInPool())
+	{
+		return;
+	}
+
+	Projectile->DeactivateToPool();
+	ActorPools.FindOrAdd(Projectile->GetClass()).Projectiles.Add(Projectile);
+}
+
+bool UGASProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UGASProjectileSubsystem::FindOrAddType(TSubclassOf<AGASProjectile> ProjectileClass)
+{
+	for (int32 TypeIndex = 0; TypeIndex < Types.Num(); TypeIndex++)
+	{
+		if (Types[TypeIndex].ProjectileClass == ProjectileClass)
+		{
+			return TypeIndex;
+		}
+	}
+
+	const AGASProjectile* DefaultProjectile = ProjectileClass.GetDefaultObject();
+
+	FGASProjectileType& Type = Types.AddDefaulted_GetRef();
+	Type.ProjectileClass = ProjectileClass;
+	Type.Radius = DefaultProjectile->SimulatedRadius;
+	Type.GravityZ = DefaultProjectile->ProjectileMovement ? DefaultProjectile->ProjectileMovement->ProjectileGravityScale * GetWorld()->GetGravityZ() : 0.0f;
+	Type.NetCullDistanceSquared = DefaultProjectile->NetCullDistanceSquared;
+
+	if (GetWorld()->GetNetMode() != NM_DedicatedServer && DefaultProjectile->SimulatedMesh)
+	{
+		if (!IsValid(VisualsActor))
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.ObjectFlags |= RF_Transient;
+			VisualsActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+		}
+
+		Type.Instances = NewObject<UInstancedStaticMeshComponent>(VisualsActor);
+		Type.Instances->SetMobility(EComponentMobility::Movable);
+		Type.Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Type.Instances->SetStaticMesh(DefaultProjectile->SimulatedMesh);
+		if (!VisualsActor->GetRootComponent())
+		{
+			VisualsActor->SetRootComponent(Type.Instances);
+		}
+
+		Type.Instances->RegisterComponent();
+	}
+
+	return Types.Num() - 1;
+}
+
+void UGASProjectileSubsystem::AddProjectile(int32 TypeIndex, const FVector& Origin, const FVector& Velocity, float Range, uint32 ProjectileId, AActor* Instigator, const FGameplayEffectSpecHandle& DamageEffectSpecHandle, int16 PredictionKey)
+{
+	Locations.Add(Origin);
+	Velocities.Add(Velocity);
+	RemainingRanges.Add(Range);
+	TypeIndices.Add(TypeIndex);
+	ProjectileIds.Add(ProjectileId);
+	Instigators.Add(Instigator);
+	PredictionKeys.Add(PredictionKey);
+	DamageSpecs.Add(DamageEffectSpecHandle);
+	RewindOffsets.Add(0.0f);
+}
+
+bool UGASProjectileSubsystem::GetProjectileVelocity(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, FVector& OutVelocity) const
+{
+	if (!ProjectileClass)
+	{
+		return false;
+	}
+
+	const UProjectileMovementComponent* DefaultMovement = ProjectileClass.GetDefaultObject()->ProjectileMovement;
+	float Speed = DefaultMovement ? DefaultMovement->InitialSpeed : 0.0f;
+	if (Speed <= 0.0f && DefaultMovement)
+	{
+		// Same fallback as UProjectileMovementComponent
+		Speed = DefaultMovement->MaxSpeed;
+	}
+
+	if (Speed <= 0.0f)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s() %s has no InitialSpeed or MaxSpeed to simulate with."), *FString(__FUNCTION__), *ProjectileClass->GetName());
+		return false;
+	}
+
+	OutVelocity = SpawnTransform.GetRotation().GetForwardVector() * Speed;
+	return true;
+}
+
+bool UGASProjectileSubsystem::ReconcilePredictedProjectile(const FGASProjectileSpawn& Spawn, AGASCharacterMain* Instigator)
+{
+	for (int32 Index = 0; Index < Locations.Num(); Index++)
+	{
+		if (PredictionKeys[Index] != Spawn.PredictionKey || Instigators[Index].Get() != Instigator)
+		{
+			continue;
+		}
+
+		// The predicted projectile is ahead of the Server's by about the round trip, which is what the player expects to see.
+		// Keep that distance but put it on the Server's path.
+		const FGASProjectileType& Type = Types[TypeIndices[Index]];
+		const float DistanceFlown = FMath::Max(Spawn.Range - RemainingRanges[Index], 0.0f);
+		const float Speed = Spawn.Velocity.Size();
+		const float TimeFlown = Speed > 0.0f ? DistanceFlown / Speed : 0.0f;
+
+		Velocities[Index] = Spawn.Velocity + FVector(0.0f, 0.0f, Type.GravityZ * TimeFlown);
+		Locations[Index] = Spawn.Origin + Spawn.Velocity * TimeFlown + FVector(0.0f, 0.0f, 0.5f * Type.GravityZ * TimeFlown * TimeFlown);
+		RemainingRanges[Index] = Spawn.Range - DistanceFlown;
+		ProjectileIds[Index] = Spawn.ProjectileId;
+		PredictionKeys[Index] = 0;
+
+		INC_DWORD_STAT(STAT_GASPredictedProjectilesReconciled);
+		return true;
+	}
+
+	return false;
+}
+
+void UGASProjectileSubsystem::OnPredictionKeyRejected(int16 PredictionKey)
+{
+	for (int32 Index = Locations.Num() - 1; Index >= 0; Index--)
+	{
+		if (PredictionKeys[Index] == PredictionKey)
+		{
+			INC_DWORD_STAT(STAT_GASPredictedProjectilesRejected);
+			RemoveProjectileAt(Index);
+		}
+	}
+}
+
+void UGASProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	Locations.RemoveAtSwap(Index, 1, false);
+	Velocities.RemoveAtSwap(Index, 1, false);
+	RemainingRanges.RemoveAtSwap(Index, 1, false);
+	TypeIndices.RemoveAtSwap(Index, 1, false);
+	ProjectileIds.RemoveAtSwap(Index, 1, false);
+	Instigators.RemoveAtSwap(Index, 1, false);
+	PredictionKeys.RemoveAtSwap(Index, 1, false);
+	DamageSpecs.RemoveAtSwap(Index, 1, false);
+	RewindOffsets.RemoveAtSwap(Index, 1, false);
+}
+
+void UGASProjectileSubsystem::SendPendingSpawns()
+{
+	if (PendingSpawns.Num() == 0)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		// Local players see the Server's own simulation
+		AGASPlayerController* PC = Cast<AGASPlayerController>(It->Get());
+		if (!PC || PC->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		ConnectionSpawns.Reset();
+		for (const FGASProjectileSpawn& Spawn : PendingSpawns)
+		{
+			// The whole flight counts, a shot from far away can still land next to this player. Gravity drop is ignored.
+			const FVector End = Spawn.Origin + Spawn.Velocity.GetSafeNormal() * Spawn.Range;
+			const float CullDistanceSquared = Types[FindOrAddType(Spawn.ProjectileClass)].NetCullDistanceSquared;
+			if (Spawn.Instigator == PC->GetPawn() || FMath::PointDistToSegmentSquared(ViewLocation, Spawn.Origin, End) <= CullDistanceSquared)
+			{
+				ConnectionSpawns.Add(Spawn);
+			}
+		}
+
+		if (ConnectionSpawns.Num() > 0)
+		{
+			PC->ClientProjectileSpawns(ConnectionSpawns);
+		}
+	}
+
+	PendingSpawns.Reset();
+	ConnectionSpawns.Reset();
+}
+
+void UGASProjectileSubsystem::SimulateProjectiles(float DeltaTime)
+{
+	const int32 NumProjectiles = Locations.Num();
+	if (NumProjectiles == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const bool bIsServer = World->GetNetMode() != NM_Client;
+
+	// Registered characters are traced in the recorded history instead of by the sweeps, so a hit lands where the shooter saw it.
+	// Other pawns are still hit by the sweeps.
+	const UGASLagCompensationSubsystem* LagCompensation = bIsServer ? World->GetSubsystem<UGASLagCompensationSubsystem>() : nullptr;
+	const bool bLagCompensate = LagCompensation && LagCompensation->HasHistory();
+	const double Now = World->GetTimeSeconds();
+
+	SweepHits.SetNum(NumProjectiles, false);
+	SweepBlocked.SetNum(NumProjectiles, false);
+	RewindHits.SetNum(NumProjectiles, false);
+
+	// Resolve on the game thread, the sweeps only read the raw pointers
+	TArray<const AActor*, TInlineAllocator<64>> IgnoredActors;
+	TArray<int32, TInlineAllocator<64>> IgnoredSlots;
+	IgnoredActors.SetNum(NumProjectiles);
+	IgnoredSlots.SetNum(NumProjectiles);
+	for (int32 Index = 0; Index < NumProjectiles; Index++)
+	{
+		IgnoredActors[Index] = Instigators[Index].Get();
+		IgnoredSlots[Index] = bLagCompensate ? LagCompensation->GetCharacterSlot(IgnoredActors[Index]) : INDEX_NONE;
+	}
+
+	FCollisionObjectQueryParams ObjectQueryParams;
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_GASProjectileSweeps);
+
+		ParallelFor(NumProjectiles, [&](int32 Index)
+		{
+			const FGASProjectileType& Type = Types[TypeIndices[Index]];
+
+			FVector Velocity = Velocities[Index];
+			Velocity.Z += Type.GravityZ * DeltaTime;
+
+			const FVector Start = Locations[Index];
+			FVector Delta = Velocity * DeltaTime;
+			float Distance = Delta.Size();
+			if (Distance > RemainingRanges[Index] && Distance > 0.0f)
+			{
+				Delta *= RemainingRanges[Index] / Distance;
+				Distance = RemainingRanges[Index];
+			}
+
+			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GASProjectileSweep), false, IgnoredActors[Index]);
+			SweepBlocked[Index] = World->SweepSingleByObjectType(SweepHits[Index], Start, Start + Delta, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(Type.Radius), QueryParams);
+
+			// Sweep again past registered characters, the history has them
+			while (bLagCompensate && SweepBlocked[Index] && LagCompensation->GetCharacterSlot(SweepHits[Index].GetActor()) != INDEX_NONE)
+			{
+				QueryParams.AddIgnoredActor(SweepHits[Index].GetActor());
+				SweepBlocked[Index] = World->SweepSingleByObjectType(SweepHits[Index], Start, Start + Delta, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(Type.Radius), QueryParams);
+			}
+			Locations[Index] = SweepBlocked[Index] ? SweepHits[Index].Location : Start + Delta;
+
+			FGASRewindHit& RewindHit = RewindHits[Index];
+			RewindHit.Slot = INDEX_NONE;
+			if (bLagCompensate)
+			{
+				const float WorldHitTime = SweepBlocked[Index] ? SweepHits[Index].Time : 1.0f;
+				if (LagCompensation->RewindTrace(Start, Start + Delta, Type.Radius, Now - RewindOffsets[Index], IgnoredSlots[Index], RewindHit) && RewindHit.Time < WorldHitTime)
+				{
+					SweepBlocked[Index] = true;
+					Locations[Index] = RewindHit.Location;
+				}
+				else
+				{
+					RewindHit.Slot = INDEX_NONE;
+				}
+			}
+			Velocities[Index] = Velocity;
+			RemainingRanges[Index] -= Distance;
+		}, NumProjectiles < GASProjectiles::ParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	// Backwards so RemoveAtSwap only moves projectiles that were already handled
+	for (int32 Index = NumProjectiles - 1; Index >= 0; Index--)
+	{
+		if (SweepBlocked[Index])
+		{
+			if (bIsServer && RewindHits[Index].Slot != INDEX_NONE)
+			{
+				const FGASRewindHit& RewindHit = RewindHits[Index];
+				AGASCharacterMain* Character = LagCompensation->GetCharacterInSlot(RewindHit.Slot);
+
+				FHitResult Hit(Character, Character ? Character->GetCapsuleComponent() : nullptr, RewindHit.Location, RewindHit.Normal);
+				Hit.ImpactPoint = RewindHit.Location - RewindHit.Normal * Types[TypeIndices[Index]].Radius;
+				Hit.Time = RewindHit.Time;
+				ApplyHit(Index, Hit);
+			}
+			else if (bIsServer)
+			{
+				ApplyHit(Index, SweepHits[Index]);
+			}
+
+			RemoveProjectileAt(Index);
+		}
+		else if (RemainingRanges[Index] <= 0.0f)
+		{
+			RemoveProjectileAt(Index);
+		}
+	}
+}
+
+void UGASProjectileSubsystem::ApplyHit(int32 Index, const FHitResult& Hit)
+{
+	const FGameplayEffectSpecHandle& DamageSpec = DamageSpecs[Index];
+	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Hit.GetActor());
+	if (!TargetASC || !DamageSpec.IsValid())
+	{
+		return;
+	}
+
+	DamageSpec.Data->GetContext().AddHitResult(Hit, true);
+
+	UAbilitySystemComponent* SourceASC = DamageSpec.Data->GetContext().GetInstigatorAbilitySystemComponent();
+	if (SourceASC)
+	{
+		SourceASC->ApplyGameplayEffectSpecToTarget(*DamageSpec.Data.Get(), TargetASC);
+	}
+	else
+	{
+		TargetASC->ApplyGameplayEffectSpecToSelf(*DamageSpec.Data.Get());
+	}
+}
+
+void UGASProjectileSubsystem::UpdateVisuals()
+{
+	TArray<TArray<FTransform>, TInlineAllocator<4>> TypeTransforms;
+	TypeTransforms.SetNum(Types.Num());
+
+	for (int32 Index = 0; Index < Locations.Num(); Index++)
+	{
+		TypeTransforms[TypeIndices[Index]].Emplace(Velocities[Index].Rotation(), Locations[Index]);
+	}
+
+	for (int32 TypeIndex = 0; TypeIndex < Types.Num(); TypeIndex++)
+	{
+		UInstancedStaticMeshComponent* Instances = Types[TypeIndex].Instances;
+		if (!Instances)
+		{
+			continue;
+		}
+
+		const TArray<FTransform>& Transforms = TypeTransforms[TypeIndex];
+		const int32 NumInstances = Instances->GetInstanceCount();
+
+		// Keep existing instances and only add or trim the tail, then move them all in one batch
+		if (NumInstances > Transforms.Num())
+		{
+			TArray<int32> InstancesToRemove;
+			for (int32 InstanceIndex = Transforms.Num(); InstanceIndex < NumInstances; InstanceIndex++)
+			{
+				InstancesToRemove.Add(InstanceIndex);
+			}
+
+			Instances->RemoveInstances(InstancesToRemove);
+		}
+		else if (NumInstances < Transforms.Num())
+		{
+			Instances->AddInstances(TArray<FTransform>(Transforms.GetData() + NumInstances, Transforms.Num() - NumInstances), false, true);
+		}
+
+		if (Transforms.Num() > 0)
+		{
+			Instances->BatchUpdateInstancesTransforms(0, Transforms, true, true, true);
+		}
+	}
+}
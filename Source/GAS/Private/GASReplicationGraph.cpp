@@ -0,0 +1,244 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASReplicationGraph.h"
+#include "Characters/GASProjectile.h"
+#include "Characters/Heroes/GASHeroCharacter.h"
+#include "Characters/Minions/GASMinionCharacter.h"
+#include "Engine/LevelScriptActor.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GAS.h"
+#include "ReplicationGraphTypes.h"
+#include "UObject/UObjectIterator.h"
+
+DECLARE_CYCLE_STAT(TEXT("GAS RepGraph Character Frequency Gather"), STAT_GASRepGraphCharacterFrequency, STATGROUP_GAS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS RepGraph Characters Throttled"), STAT_GASRepGraphCharactersThrottled, STATGROUP_GAS);
+
+void UGASReplicationGraphNode_CharacterFrequency::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	Characters.Add(ActorInfo.Actor);
+}
+
+bool UGASReplicationGraphNode_CharacterFrequency::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	return Characters.RemoveFast(ActorInfo.Actor);
+}
+
+void UGASReplicationGraphNode_CharacterFrequency::NotifyResetAllNetworkActors()
+{
+	Characters.Reset();
+}
+
+void UGASReplicationGraphNode_CharacterFrequency::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASRepGraphCharacterFrequency);
+
+	if (Characters.Num() == 0)
+	{
+		return;
+	}
+
+	// Every character is gathered every frame so its channel stays open, distance only stretches its per connection period
+	for (const FActorRepListType& Actor : Characters)
+	{
+		float DistanceSquared = UE_BIG_NUMBER;
+		for (const FNetViewer& Viewer : Params.Viewers)
+		{
+			DistanceSquared = FMath::Min<float>(DistanceSquared, FVector::DistSquared(Viewer.ViewLocation, Actor->GetActorLocation()));
+		}
+
+		int32 PeriodMultiplier = Buckets.Num() > 0 ? Buckets.Last().PeriodMultiplier : 1;
+		for (const FGASReplicationFrequencyBucket& Bucket : Buckets)
+		{
+			if (DistanceSquared <= FMath::Square(Bucket.MaxDistance))
+			{
+				PeriodMultiplier = Bucket.PeriodMultiplier;
+				break;
+			}
+		}
+
+		const uint16 ClassPeriod = GraphGlobals->GlobalActorReplicationInfoMap->Get(Actor).Settings.ReplicationPeriodFrame;
+		FConnectionReplicationActorInfo& ConnectionInfo = Params.ConnectionManager.ActorInfoMap.FindOrAdd(Actor);
+		ConnectionInfo.ReplicationPeriodFrame = static_cast<uint16>(FMath::Clamp<int32>(ClassPeriod * FMath::Max(PeriodMultiplier, 1), 1, MAX_uint16));
+
+		if (PeriodMultiplier > 1)
+		{
+			INC_DWORD_STAT(STAT_GASRepGraphCharactersThrottled);
+		}
+	}
+
+	Params.OutGatheredReplicationLists.AddReplicationActorList(Characters);
+}
+
+UGASReplicationGraph::UGASReplicationGraph()
+{
+	SpatialCellSize = 10000.0f;
+	SpatialBias = FVector2D(-200000.0f, -200000.0f);
+
+	FGASReplicationFrequencyBucket& Near = CharacterFrequencyBuckets.AddDefaulted_GetRef();
+	Near.MaxDistance = 5000.0f;
+	Near.PeriodMultiplier = 1;
+
+	FGASReplicationFrequencyBucket& Mid = CharacterFrequencyBuckets.AddDefaulted_GetRef();
+	Mid.MaxDistance = 15000.0f;
+	Mid.PeriodMultiplier = 3;
+
+	FGASReplicationFrequencyBucket& Far = CharacterFrequencyBuckets.AddDefaulted_GetRef();
+	Far.MaxDistance = UE_BIG_NUMBER;
+	Far.PeriodMultiplier = 6;
+}
+
+void UGASReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), EGASClassRepNodeMapping::RelevantAllConnections);
+	// Heroes' ASCs and attributes live on their player states
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), EGASClassRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), EGASClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), EGASClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(AGASHeroCharacter::StaticClass(), EGASClassRepNodeMapping::CharacterFrequency);
+	ClassRepNodePolicies.Set(AGASMinionCharacter::StaticClass(), EGASClassRepNodeMapping::Spatialize_Dormancy);
+	ClassRepNodePolicies.Set(AGASProjectile::StaticClass(), EGASClassRepNodeMapping::Spatialize_Dormancy);
+
+	// Replication settings for every replicated actor class, from its class defaults
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+		if (!ActorCDO || !ActorCDO->GetIsReplicated() || Class->HasAnyClassFlags(CLASS_Abstract)
+			|| Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const EGASClassRepNodeMapping Mapping = GetMappingPolicy(Class);
+		const bool bSpatialize = Mapping == EGASClassRepNodeMapping::Spatialize_Static
+			|| Mapping == EGASClassRepNodeMapping::Spatialize_Dynamic
+			|| Mapping == EGASClassRepNodeMapping::Spatialize_Dormancy;
+
+		FClassReplicationInfo ClassInfo;
+		InitClassReplicationInfo(ClassInfo, Class, bSpatialize);
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+}
+
+void UGASReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = SpatialCellSize;
+	GridNode->SpatialBias = SpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	CharacterFrequencyNode = CreateNewNode<UGASReplicationGraphNode_CharacterFrequency>();
+	CharacterFrequencyNode->Buckets = CharacterFrequencyBuckets;
+	CharacterFrequencyNode->Buckets.Sort([](const FGASReplicationFrequencyBucket& A, const FGASReplicationFrequencyBucket& B)
+	{
+		return A.MaxDistance < B.MaxDistance;
+	});
+	AddGlobalGraphNode(CharacterFrequencyNode);
+}
+
+void UGASReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	// The connection's own controller, pawn and view target
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantForConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(AlwaysRelevantForConnectionNode, RepGraphConnection);
+}
+
+void UGASReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EGASClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case EGASClassRepNodeMapping::Spatialize_Static:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+	case EGASClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	case EGASClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+	case EGASClassRepNodeMapping::CharacterFrequency:
+		CharacterFrequencyNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	default:
+		break;
+	}
+}
+
+void UGASReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EGASClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case EGASClassRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+	case EGASClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	case EGASClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+	case EGASClassRepNodeMapping::CharacterFrequency:
+		CharacterFrequencyNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	default:
+		break;
+	}
+}
+
+EGASClassRepNodeMapping UGASReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+	if (const EGASClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	// Not set explicitly, decide from the class defaults like the legacy relevancy checks would
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	EGASClassRepNodeMapping Policy = EGASClassRepNodeMapping::Spatialize_Dynamic;
+	if (!ActorCDO || ActorCDO->bOnlyRelevantToOwner)
+	{
+		Policy = EGASClassRepNodeMapping::NotRouted;
+	}
+	else if (ActorCDO->bAlwaysRelevant)
+	{
+		Policy = EGASClassRepNodeMapping::RelevantAllConnections;
+	}
+	else if (ActorCDO->GetRootComponent() && ActorCDO->GetRootComponent()->Mobility == EComponentMobility::Static)
+	{
+		Policy = EGASClassRepNodeMapping::Spatialize_Static;
+	}
+	else if (ActorCDO->NetDormancy > DORM_Awake)
+	{
+		Policy = EGASClassRepNodeMapping::Spatialize_Dormancy;
+	}
+
+	ClassRepNodePolicies.Set(Class, Policy);
+	return Policy;
+}
+
+void UGASReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const
+{
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	if (bSpatialize)
+	{
+		Info.SetCullDistanceSquared(ActorCDO->NetCullDistanceSquared);
+	}
+
+	Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(FMath::Max(ActorCDO->NetUpdateFrequency, 1.0f));
+}
@@ -0,0 +1,33 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASSpawnPoint.h"
+#include "Engine/World.h"
+#include "GASSpawnPointSubsystem.h"
+
+AGASSpawnPoint::AGASSpawnPoint(const class FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+}
+
+void AGASSpawnPoint::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// Register before BeginPlay so spawn points are available to players that log in while the world is starting
+	UGASSpawnPointSubsystem* SpawnPoints = GetWorld() ? GetWorld()->GetSubsystem<UGASSpawnPointSubsystem>() : nullptr;
+	if (SpawnPoints)
+	{
+		SpawnPoints->RegisterSpawnPoint(this);
+	}
+}
+
+void AGASSpawnPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGASSpawnPointSubsystem* SpawnPoints = GetWorld() ? GetWorld()->GetSubsystem<UGASSpawnPointSubsystem>() : nullptr;
+	if (SpawnPoints)
+	{
+		SpawnPoints->UnregisterSpawnPoint(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,66 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASSpawnPointSubsystem.h"
+#include "GASSpawnPoint.h"
+
+void UGASSpawnPointSubsystem::Deinitialize()
+{
+	SpawnPointsByTag.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGASSpawnPointSubsystem::RegisterSpawnPoint(AGASSpawnPoint* SpawnPoint)
+{
+	if (!IsValid(SpawnPoint))
+	{
+		return;
+	}
+
+	if (SpawnPoint->PlayerStartTag.IsNone())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s() %s has no PlayerStartTag and won't be used by the GameMode."), *FString(__FUNCTION__), *SpawnPoint->GetName());
+	}
+
+	SpawnPointsByTag.FindOrAdd(SpawnPoint->PlayerStartTag).SpawnPoints.AddUnique(SpawnPoint);
+}
+
+void UGASSpawnPointSubsystem::UnregisterSpawnPoint(AGASSpawnPoint* SpawnPoint)
+{
+	FGASSpawnPointList* List = SpawnPointsByTag.Find(SpawnPoint->PlayerStartTag);
+	if (List)
+	{
+		List->SpawnPoints.Remove(SpawnPoint);
+	}
+}
+
+AGASSpawnPoint* UGASSpawnPointSubsystem::FindSpawnPoint(FName SpawnTag)
+{
+	FGASSpawnPointList* List = SpawnPointsByTag.Find(SpawnTag);
+	if (!List)
+	{
+		return nullptr;
+	}
+
+	while (List->SpawnPoints.Num() > 0)
+	{
+		const int32 Index = List->NextIndex % List->SpawnPoints.Num();
+		AGASSpawnPoint* SpawnPoint = List->SpawnPoints[Index];
+		if (IsValid(SpawnPoint))
+		{
+			List->NextIndex = Index + 1;
+			return SpawnPoint;
+		}
+
+		List->SpawnPoints.RemoveAt(Index);
+	}
+
+	return nullptr;
+}
+
+int32 UGASSpawnPointSubsystem::GetNumSpawnPoints(FName SpawnTag) const
+{
+	const FGASSpawnPointList* List = SpawnPointsByTag.Find(SpawnTag);
+	return List ? List->SpawnPoints.Num() : 0;
+}
@@ -7,6 +7,10 @@
 #include "..\..\Public\Player\GASPlayerState.h"
 #include "..\..\Public\UI\GASDamageTextWidgetComponent.h"
 #include "..\..\Public\UI\GASHUDWidget.h"
+#include "GAS.h"
+#include "GASProjectileSubsystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("GAS Damage Text Allocations"), STAT_GASDamageTextAllocations, STATGROUP_GAS);
 
 void AGASPlayerController::CreateHUD()
 {
@@ -61,20 +65,152 @@ UGASHUDWidget * AGASPlayerController::GetHUD()
 	return UIHUDWidget;
 }
 
-void AGASPlayerController::ShowDamageNumber_Implementation(float DamageAmount, AGASCharacterMain* TargetCharacter)
+bool FGASDamageNumber::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	UObject* Target = TargetCharacter;
+	bOutSuccess = Map->SerializeObject(Ar, AGASCharacterMain::StaticClass(), Target);
+
+	uint32 QuantizedDamage = Ar.IsSaving() ? static_cast<uint32>(FMath::RoundToInt(FMath::Clamp(Damage, 0.0f, 1000000.0f) * 10.0f)) : 0;
+	Ar.SerializeIntPacked(QuantizedDamage);
+
+	if (Ar.IsLoading())
+	{
+		// Target may not be relevant to this client
+		TargetCharacter = Cast<AGASCharacterMain>(Target);
+		Damage = QuantizedDamage * 0.1f;
+	}
+
+	return true;
+}
+
+void AGASPlayerController::QueueDamageNumber(float DamageAmount, AGASCharacterMain* TargetCharacter)
+{
+	if (!TargetCharacter)
+	{
+		return;
+	}
+
+	FGASDamageNumber* DamageNumber = nullptr;
+	if (bSumDamageNumbersPerTarget)
+	{
+		DamageNumber = PendingDamageNumbers.FindByPredicate([TargetCharacter](const FGASDamageNumber& Entry) { return Entry.TargetCharacter == TargetCharacter; });
+	}
+
+	if (!DamageNumber)
+	{
+		DamageNumber = &PendingDamageNumbers.AddDefaulted_GetRef();
+		DamageNumber->TargetCharacter = TargetCharacter;
+	}
+
+	DamageNumber->Damage += DamageAmount;
+
+	// Sent at the end of this frame, after every actor, timer and tickable object that can deal damage has run
+	if (!DamageNumberFlushHandle.IsValid())
+	{
+		DamageNumberFlushHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &AGASPlayerController::OnWorldPostActorTick);
+	}
+}
+
+void AGASPlayerController::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		FlushDamageNumbers();
+	}
+}
+
+void AGASPlayerController::FlushDamageNumbers()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(DamageNumberFlushHandle);
+	DamageNumberFlushHandle.Reset();
+
+	// Targets destroyed or put back in the minion pool since they were queued
+	PendingDamageNumbers.RemoveAllSwap([](const FGASDamageNumber& Entry)
+	{
+		return !IsValid(Entry.TargetCharacter) || !Entry.TargetCharacter->IsCharacterActive();
+	});
+
+	if (PendingDamageNumbers.Num() > 0)
+	{
+		ClientShowDamageNumbers(PendingDamageNumbers);
+		PendingDamageNumbers.Reset();
+	}
+}
+
+void AGASPlayerController::ClientShowDamageNumbers_Implementation(const TArray<FGASDamageNumber>& DamageNumbers)
+{
+	for (const FGASDamageNumber& DamageNumber : DamageNumbers)
+	{
+		ShowDamageNumber(DamageNumber.Damage, DamageNumber.TargetCharacter);
+	}
+}
+
+void AGASPlayerController::ClientProjectileSpawns_Implementation(const TArray<FGASProjectileSpawn>& Spawns)
+{
+	UGASProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UGASProjectileSubsystem>();
+	if (Projectiles)
+	{
+		Projectiles->AddSimulatedProjectiles(Spawns);
+	}
+}
+
+void AGASPlayerController::ShowDamageNumber(float DamageAmount, AGASCharacterMain* TargetCharacter)
 {
 	if (TargetCharacter && DamageNumberClass)
 	{
-		UGASDamageTextWidgetComponent* DamageText = NewObject<UGASDamageTextWidgetComponent>(TargetCharacter, DamageNumberClass);
+		UGASDamageTextWidgetComponent* DamageText = AcquireDamageText();
+		if (DamageText)
+		{
+			// Pooled components may have been moved by their last animation
+			DamageText->SetRelativeTransform(DamageNumberClass.GetDefaultObject()->GetRelativeTransform());
+			DamageText->AttachToComponent(TargetCharacter->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+			DamageText->ActivateDamageText(DamageAmount);
+		}
+	}
+}
+
+UGASDamageTextWidgetComponent* AGASPlayerController::AcquireDamageText()
+{
+	// Damage texts destroyed outside of the pool
+	ActiveDamageTexts.RemoveAll([](const UGASDamageTextWidgetComponent* DamageText) { return !IsValid(DamageText); });
+	FreeDamageTexts.RemoveAll([](const UGASDamageTextWidgetComponent* DamageText) { return !IsValid(DamageText); });
+
+	UGASDamageTextWidgetComponent* DamageText = nullptr;
+
+	if (FreeDamageTexts.Num() > 0)
+	{
+		DamageText = FreeDamageTexts.Pop(false);
+	}
+	else if (ActiveDamageTexts.Num() < FMath::Max(DamageTextPoolSize, 1))
+	{
+		INC_DWORD_STAT(STAT_GASDamageTextAllocations);
+
+		DamageText = NewObject<UGASDamageTextWidgetComponent>(this, DamageNumberClass);
 		DamageText->RegisterComponent();
-		DamageText->AttachToComponent(TargetCharacter->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-		DamageText->SetDamageText(DamageAmount);
 	}
+	else
+	{
+		// Pool exhausted, recycle the oldest
+		DamageText = ActiveDamageTexts[0];
+		ActiveDamageTexts.RemoveAt(0, 1, false);
+		DamageText->DeactivateDamageText();
+	}
+
+	ActiveDamageTexts.Add(DamageText);
+	return DamageText;
 }
 
-bool AGASPlayerController::ShowDamageNumber_Validate(float DamageAmount, AGASCharacterMain* TargetCharacter)
+bool AGASPlayerController::ReleaseDamageText(UGASDamageTextWidgetComponent* DamageText)
 {
-	return true;
+	if (ActiveDamageTexts.Remove(DamageText) > 0)
+	{
+		DamageText->DeactivateDamageText();
+		FreeDamageTexts.Add(DamageText);
+		return true;
+	}
+
+	// Already released, e.g. by its Lifetime timer before the Blueprint finished
+	return FreeDamageTexts.Contains(DamageText);
 }
 
 void AGASPlayerController::SetRespawnCountdown_Implementation(float RespawnTimeRemaining)
@@ -91,6 +227,14 @@ bool AGASPlayerController::SetRespawnCountdown_Validate(float RespawnTimeRemaini
 }
 
 // Server only
+void AGASPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(DamageNumberFlushHandle);
+	DamageNumberFlushHandle.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AGASPlayerController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
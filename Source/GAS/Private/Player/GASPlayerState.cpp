@@ -3,8 +3,10 @@
 
 #include "..\..\Public\Player\GASPlayerState.h"
 #include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
+#include "Characters/Abilities/AttributeSets/GASAttributeSetEconomy.h"
 #include "Characters/Abilities/GASAbilitySystemComponent.h"
 #include "Characters/Heroes/GASHeroCharacter.h"
+#include "GASGameplayTags.h"
 #include "..\..\Public\Player\GASPlayerController.h"
 #include "..\..\Public\UI\GASFloatingStatusBarWidget.h"
 #include "..\..\Public\UI\GASHUDWidget.h"
@@ -23,14 +25,12 @@ AGASPlayerState::AGASPlayerState()
 	// Adding it as a subobject of the owning actor of an AbilitySystemComponent
 	// automatically registers the AttributeSet with the AbilitySystemComponent
 	AttributeSetBase = CreateDefaultSubobject<UGASAttributeSetBase>(TEXT("AttributeSetBase"));
+	AttributeSetEconomy = CreateDefaultSubobject<UGASAttributeSetEconomy>(TEXT("AttributeSetEconomy"));
 
 	// Set PlayerState's NetUpdateFrequency to the same as the Character.
 	// Default is very low for PlayerStates and introduces perceived lag in the ability system.
 	// 100 is probably way too high for a shipping game, you can adjust to fit your needs.
 	NetUpdateFrequency = 100.0f;
-
-	// Cache tags
-	DeadTag = FGameplayTag::RequestGameplayTag(FName("State.Dead"));
 }
 
 UAbilitySystemComponent * AGASPlayerState::GetAbilitySystemComponent() const
@@ -43,6 +43,11 @@ UGASAttributeSetBase * AGASPlayerState::GetAttributeSetBase() const
 	return AttributeSetBase;
 }
 
+UGASAttributeSetEconomy * AGASPlayerState::GetAttributeSetEconomy() const
+{
+	return AttributeSetEconomy;
+}
+
 bool AGASPlayerState::IsAlive() const
 {
 	return GetHealth() > 0.0f;
@@ -123,22 +128,22 @@ int32 AGASPlayerState::GetCharacterLevel() const
 
 int32 AGASPlayerState::GetXP() const
 {
-	return AttributeSetBase->GetXP();
+	return AttributeSetEconomy->GetXP();
 }
 
 int32 AGASPlayerState::GetXPBounty() const
 {
-	return AttributeSetBase->GetXPBounty();
+	return AttributeSetEconomy->GetXPBounty();
 }
 
 int32 AGASPlayerState::GetGold() const
 {
-	return AttributeSetBase->GetGold();
+	return AttributeSetEconomy->GetGold();
 }
 
 int32 AGASPlayerState::GetGoldBounty() const
 {
-	return AttributeSetBase->GetGoldBounty();
+	return AttributeSetEconomy->GetGoldBounty();
 }
 
 void AGASPlayerState::BeginPlay()
@@ -157,12 +162,12 @@ void AGASPlayerState::BeginPlay()
 		StaminaChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetStaminaAttribute()).AddUObject(this, &AGASPlayerState::StaminaChanged);
 		MaxStaminaChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetMaxStaminaAttribute()).AddUObject(this, &AGASPlayerState::MaxStaminaChanged);
 		StaminaRegenRateChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetStaminaRegenRateAttribute()).AddUObject(this, &AGASPlayerState::StaminaRegenRateChanged);
-		XPChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetXPAttribute()).AddUObject(this, &AGASPlayerState::XPChanged);
-		GoldChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetGoldAttribute()).AddUObject(this, &AGASPlayerState::GoldChanged);
+		XPChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetEconomy->GetXPAttribute()).AddUObject(this, &AGASPlayerState::XPChanged);
+		GoldChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetEconomy->GetGoldAttribute()).AddUObject(this, &AGASPlayerState::GoldChanged);
 		CharacterLevelChangedDelegateHandle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSetBase->GetCharacterLevelAttribute()).AddUObject(this, &AGASPlayerState::CharacterLevelChanged);
 
 		// Tag change callbacks
-		AbilitySystemComponent->RegisterGameplayTagEvent(FGameplayTag::RequestGameplayTag(FName("State.Debuff.Stun")), EGameplayTagEventType::NewOrRemoved).AddUObject(this, &AGASPlayerState::StunTagChanged);
+		AbilitySystemComponent->RegisterGameplayTagEvent(FGASGameplayTags::Get().State_Debuff_Stun, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &AGASPlayerState::StunTagChanged);
 	}
 }
 
@@ -185,7 +190,7 @@ void AGASPlayerState::HealthChanged(const FOnAttributeChangeData & Data)
 	// Handled in the UI itself using the AsyncTaskAttributeChanged node as an example how to do it in Blueprint
 
 	// If the player died, handle death
-	if (!IsAlive() && !AbilitySystemComponent->HasMatchingGameplayTag(DeadTag))
+	if (!IsAlive() && !AbilitySystemComponent->HasMatchingGameplayTag(FGASGameplayTags::Get().State_Dead))
 	{
 		if (Hero)
 		{
@@ -391,11 +396,13 @@ void AGASPlayerState::StunTagChanged(const FGameplayTag CallbackTag, int32 NewCo
 {
 	if (NewCount > 0)
 	{
+		const FGASGameplayTags& GameplayTags = FGASGameplayTags::Get();
+
 		FGameplayTagContainer AbilityTagsToCancel;
-		AbilityTagsToCancel.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability")));
+		AbilityTagsToCancel.AddTag(GameplayTags.Ability);
 
 		FGameplayTagContainer AbilityTagsToIgnore;
-		AbilityTagsToIgnore.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.NotCanceledByStun")));
+		AbilityTagsToIgnore.AddTag(GameplayTags.Ability_NotCanceledByStun);
 
 		AbilitySystemComponent->CancelAbilities(&AbilityTagsToCancel, &AbilityTagsToIgnore);
 	}
@@ -0,0 +1,66 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Player/GASPlayerController.h"
+#include "Characters/GASCharacterMain.h"
+#include "GASTestPackageMap.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASDamageNumberTest, "GAS.UI.DamageNumber.NetSerialize",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASDamageNumberTest::RunTest(const FString& Parameters)
+{
+	UGASTestPackageMap* Map = NewObject<UGASTestPackageMap>();
+	AGASCharacterMain* Target = GetMutableDefault<AGASCharacterMain>();
+
+	auto RoundTrip = [this, Map](const FGASDamageNumber& Source, FGASDamageNumber& OutRead)
+	{
+		FGASDamageNumber Write = Source;
+		bool bWriteSuccess = false;
+		FBitWriter Writer(0, true);
+		Write.NetSerialize(Writer, Map, bWriteSuccess);
+
+		bool bReadSuccess = false;
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		OutRead.NetSerialize(Reader, Map, bReadSuccess);
+
+		TestTrue(TEXT("Serialized"), bWriteSuccess && bReadSuccess && !Writer.IsError() && !Reader.IsError());
+	};
+
+	FGASDamageNumber Source;
+	Source.TargetCharacter = Target;
+	Source.Damage = 12.34f;
+
+	FGASDamageNumber Read;
+	RoundTrip(Source, Read);
+	TestTrue(TEXT("Target"), Read.TargetCharacter == Target);
+	TestEqual(TEXT("Damage rounded to 0.1"), Read.Damage, 12.3f, 0.001f);
+
+	Source.Damage = 0.06f;
+	RoundTrip(Source, Read);
+	TestEqual(TEXT("Small damage"), Read.Damage, 0.1f, 0.001f);
+
+	Source.Damage = -5.0f;
+	RoundTrip(Source, Read);
+	TestEqual(TEXT("Negative damage is clamped to 0"), Read.Damage, 0.0f);
+
+	Source.Damage = 2000000.0f;
+	RoundTrip(Source, Read);
+	TestEqual(TEXT("Damage is clamped to 1000000"), Read.Damage, 1000000.0f, 0.1f);
+
+	// Targets that aren't relevant to the client come through as null
+	Source.TargetCharacter = nullptr;
+	Source.Damage = 50.0f;
+	RoundTrip(Source, Read);
+	TestTrue(TEXT("Null target"), Read.TargetCharacter == nullptr);
+	TestEqual(TEXT("Damage with a null target"), Read.Damage, 50.0f, 0.001f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,90 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASLagCompensationSubsystem.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASLagCompensationTest
+{
+	// Default character capsule, the cylinder part of the axis ends at Z = +-54
+	const FVector Center = FVector::ZeroVector;
+	const float Radius = 34.0f;
+	const float HalfHeight = 88.0f;
+	const float SweepRadius = 5.0f;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASLagCompensationSweepCapsuleTest, "GAS.LagCompensation.SweepCapsule",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASLagCompensationSweepCapsuleTest::RunTest(const FString& Parameters)
+{
+	using namespace GASLagCompensationTest;
+
+	float Time = 0.0f;
+	FVector Location;
+	FVector Normal;
+
+	// Straight through the middle, touches the side at X = -(34 + 5)
+	bool bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(-100.0, 0.0, 0.0), FVector(100.0, 0.0, 0.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestTrue(TEXT("Hits through the middle"), bHit);
+	TestEqual(TEXT("Time"), Time, 61.0f / 200.0f, 0.001f);
+	TestEqual(TEXT("Location"), Location, FVector(-39.0, 0.0, 0.0), 0.01f);
+	TestEqual(TEXT("Normal"), Normal, FVector(-1.0, 0.0, 0.0), 0.001f);
+
+	// Grazing the side
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(-100.0, 38.0, 0.0), FVector(100.0, 38.0, 0.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestTrue(TEXT("Hits within radius + sweep radius"), bHit);
+
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(-100.0, 40.0, 0.0), FVector(100.0, 40.0, 0.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestFalse(TEXT("Misses beside the capsule"), bHit);
+
+	// Over the top hemisphere, centered at Z = 54
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(-100.0, 0.0, 92.0), FVector(100.0, 0.0, 92.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestTrue(TEXT("Hits the top hemisphere"), bHit);
+	TestTrue(TEXT("Normal points up and back"), Normal.Z > 0.0 && Normal.X < 0.0);
+
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(-100.0, 0.0, 94.0), FVector(100.0, 0.0, 94.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestFalse(TEXT("Misses over the top"), bHit);
+
+	// Stops short of the capsule
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(-100.0, 0.0, 0.0), FVector(-40.0, 0.0, 0.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestFalse(TEXT("Misses when the sweep ends before the capsule"), bHit);
+
+	// Starting inside hits immediately
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(10.0, 0.0, 0.0), FVector(100.0, 0.0, 0.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestTrue(TEXT("Hits when starting inside"), bHit);
+	TestEqual(TEXT("Time when starting inside"), Time, 0.0f);
+
+	// Zero length sweep
+	bHit = UGASLagCompensationSubsystem::SweepCapsule(FVector(0.0, 30.0, 0.0), FVector(0.0, 30.0, 0.0), SweepRadius, Center, Radius, HalfHeight, Time, Location, Normal);
+	TestTrue(TEXT("Zero length sweep inside"), bHit);
+	TestEqual(TEXT("Zero length sweep time"), Time, 0.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASLagCompensationIsNearCapsuleTest, "GAS.LagCompensation.IsNearCapsule",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASLagCompensationIsNearCapsuleTest::RunTest(const FString& Parameters)
+{
+	using namespace GASLagCompensationTest;
+
+	const float Tolerance = 10.0f;
+
+	TestTrue(TEXT("Center"), UGASLagCompensationSubsystem::IsNearCapsule(Center, Center, Radius, HalfHeight, Tolerance));
+	TestTrue(TEXT("Side within tolerance"), UGASLagCompensationSubsystem::IsNearCapsule(FVector(43.0, 0.0, 0.0), Center, Radius, HalfHeight, Tolerance));
+	TestFalse(TEXT("Side outside tolerance"), UGASLagCompensationSubsystem::IsNearCapsule(FVector(45.0, 0.0, 0.0), Center, Radius, HalfHeight, Tolerance));
+	TestTrue(TEXT("Top within tolerance"), UGASLagCompensationSubsystem::IsNearCapsule(FVector(0.0, 0.0, 97.0), Center, Radius, HalfHeight, Tolerance));
+	TestFalse(TEXT("Top outside tolerance"), UGASLagCompensationSubsystem::IsNearCapsule(FVector(0.0, 0.0, 99.0), Center, Radius, HalfHeight, Tolerance));
+
+	// A sphere, half height no bigger than the radius
+	TestTrue(TEXT("Sphere"), UGASLagCompensationSubsystem::IsNearCapsule(FVector(0.0, 0.0, 40.0), Center, Radius, 20.0f, Tolerance));
+	TestFalse(TEXT("Outside sphere"), UGASLagCompensationSubsystem::IsNearCapsule(FVector(0.0, 0.0, 50.0), Center, Radius, 20.0f, Tolerance));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
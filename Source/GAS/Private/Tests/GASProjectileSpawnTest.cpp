@@ -0,0 +1,71 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/GASProjectile.h"
+#include "Characters/GASCharacterMain.h"
+#include "GASTestPackageMap.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASProjectileSpawnTest, "GAS.Projectiles.ProjectileSpawn.NetSerialize",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASProjectileSpawnTest::RunTest(const FString& Parameters)
+{
+	UGASTestPackageMap* Map = NewObject<UGASTestPackageMap>();
+	AGASCharacterMain* Instigator = GetMutableDefault<AGASCharacterMain>();
+
+	auto RoundTrip = [this, Map](const FGASProjectileSpawn& Source, FGASProjectileSpawn& OutRead)
+	{
+		FGASProjectileSpawn Write = Source;
+		bool bWriteSuccess = false;
+		FBitWriter Writer(0, true);
+		Write.NetSerialize(Writer, Map, bWriteSuccess);
+
+		bool bReadSuccess = false;
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		OutRead.NetSerialize(Reader, Map, bReadSuccess);
+
+		TestTrue(TEXT("Serialized"), bWriteSuccess && bReadSuccess && !Writer.IsError() && !Reader.IsError());
+		TestEqual(TEXT("Read everything that was written"), Reader.GetPosBits(), Writer.GetNumBits());
+	};
+
+	FGASProjectileSpawn Source;
+	Source.ProjectileClass = AGASProjectile::StaticClass();
+	Source.Instigator = Instigator;
+	Source.Origin = FVector(1234.56, -78.91, 10.04);
+	Source.Velocity = FVector(3000.4, -20.6, 0.0);
+	Source.Range = 1000.4f;
+	Source.ProjectileId = 123456;
+	Source.PredictionKey = 42;
+
+	FGASProjectileSpawn Read;
+	RoundTrip(Source, Read);
+	TestTrue(TEXT("Projectile class"), Read.ProjectileClass == AGASProjectile::StaticClass());
+	TestTrue(TEXT("Instigator"), Read.Instigator == Instigator);
+	TestEqual(TEXT("Origin to 0.1cm"), Read.Origin, FVector(1234.6, -78.9, 10.0), 0.051f);
+	TestEqual(TEXT("Velocity to 1cm/s"), Read.Velocity, FVector(3000.0, -21.0, 0.0), 0.51f);
+	TestEqual(TEXT("Range to 1cm"), Read.Range, 1000.0f);
+	TestEqual(TEXT("Projectile id"), Read.ProjectileId, Source.ProjectileId);
+	TestEqual(TEXT("Prediction key"), Read.PredictionKey, Source.PredictionKey);
+
+	Source.PredictionKey = -7;
+	RoundTrip(Source, Read);
+	TestEqual(TEXT("Negative prediction key"), Read.PredictionKey, static_cast<int16>(-7));
+
+	// Not predicted, Read still holds the previous key
+	Source.PredictionKey = 0;
+	Source.Instigator = nullptr;
+	Source.Range = -50.0f;
+	RoundTrip(Source, Read);
+	TestEqual(TEXT("Unpredicted key is reset"), Read.PredictionKey, static_cast<int16>(0));
+	TestTrue(TEXT("Instigator not relevant"), Read.Instigator == nullptr);
+	TestEqual(TEXT("Negative range is clamped to 0"), Read.Range, 0.0f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,107 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "Characters/Abilities/AttributeSets/GASQuantizedAttributeData.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASQuantizedAttributeDataTest
+{
+	// Writes Data and reads it back into a new value. Returns the bits written.
+	template<typename T>
+	int64 RoundTrip(const T& Data, T& OutData, bool& bOutSuccess)
+	{
+		T Source = Data;
+		bool bWriteSuccess = false;
+		FBitWriter Writer(0, true);
+		Source.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+		bool bReadSuccess = false;
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		OutData.NetSerialize(Reader, nullptr, bReadSuccess);
+
+		bOutSuccess = bWriteSuccess && bReadSuccess && !Writer.IsError() && !Reader.IsError();
+		return Writer.GetNumBits();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASVitalAttributeDataTest, "GAS.Attributes.QuantizedAttributeData.Vital",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASVitalAttributeDataTest::RunTest(const FString& Parameters)
+{
+	using namespace GASQuantizedAttributeDataTest;
+
+	bool bSuccess = false;
+	FGASVitalAttributeData Read;
+
+	// Current == Base, one 20 bit step index plus the two flags
+	int64 NumBits = RoundTrip(FGASVitalAttributeData(57.34f), Read, bSuccess);
+	TestTrue(TEXT("Serialized"), bSuccess);
+	TestEqual(TEXT("Base rounded to 0.1"), Read.GetBaseValue(), 57.3f, 0.001f);
+	TestEqual(TEXT("Current follows Base"), Read.GetCurrentValue(), Read.GetBaseValue());
+	TestTrue(FString::Printf(TEXT("At most 22 bits, got %lld"), NumBits), NumBits <= 22);
+
+	// Current != Base sends both
+	FGASVitalAttributeData Buffed(100.0f);
+	Buffed.SetCurrentValue(150.04f);
+	NumBits = RoundTrip(Buffed, Read, bSuccess);
+	TestTrue(TEXT("Serialized with Current != Base"), bSuccess);
+	TestEqual(TEXT("Base"), Read.GetBaseValue(), 100.0f, 0.001f);
+	TestEqual(TEXT("Current"), Read.GetCurrentValue(), 150.0f, 0.001f);
+	TestTrue(FString::Printf(TEXT("At most 43 bits, got %lld"), NumBits), NumBits <= 43);
+
+	// Exact 0 stays 0, a sliver never reads as 0
+	RoundTrip(FGASVitalAttributeData(0.0f), Read, bSuccess);
+	TestEqual(TEXT("Zero is exact"), Read.GetBaseValue(), 0.0f);
+
+	RoundTrip(FGASVitalAttributeData(0.01f), Read, bSuccess);
+	TestEqual(TEXT("Sliver rounds up to one step"), Read.GetBaseValue(), 0.1f, 0.001f);
+
+	// Out of range falls back to the full float
+	NumBits = RoundTrip(FGASVitalAttributeData(250000.5f), Read, bSuccess);
+	TestTrue(TEXT("Serialized out of range"), bSuccess);
+	TestEqual(TEXT("Out of range is exact"), Read.GetBaseValue(), 250000.5f);
+	TestEqual(TEXT("Out of range uses a full float"), NumBits, static_cast<int64>(2 + 32));
+
+	RoundTrip(FGASVitalAttributeData(-5.0f), Read, bSuccess);
+	TestEqual(TEXT("Negative is exact"), Read.GetBaseValue(), -5.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASRateAttributeDataTest, "GAS.Attributes.QuantizedAttributeData.Rate",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASRateAttributeDataTest::RunTest(const FString& Parameters)
+{
+	using namespace GASQuantizedAttributeDataTest;
+
+	bool bSuccess = false;
+	FGASRateAttributeData Read;
+
+	// One 17 bit step index plus the two flags
+	int64 NumBits = RoundTrip(FGASRateAttributeData(-12.344f), Read, bSuccess);
+	TestTrue(TEXT("Serialized"), bSuccess);
+	TestEqual(TEXT("Rounded to 0.01"), Read.GetBaseValue(), -12.34f, 0.001f);
+	TestTrue(FString::Printf(TEXT("At most 19 bits, got %lld"), NumBits), NumBits <= 19);
+
+	RoundTrip(FGASRateAttributeData(0.0f), Read, bSuccess);
+	TestEqual(TEXT("Zero is exact"), Read.GetBaseValue(), 0.0f);
+
+	RoundTrip(FGASRateAttributeData(-0.001f), Read, bSuccess);
+	TestEqual(TEXT("Negative sliver rounds down to one step"), Read.GetBaseValue(), -0.01f, 0.001f);
+
+	RoundTrip(FGASRateAttributeData(500.0f), Read, bSuccess);
+	TestEqual(TEXT("Top of the range"), Read.GetBaseValue(), 500.0f, 0.001f);
+
+	RoundTrip(FGASRateAttributeData(1000.25f), Read, bSuccess);
+	TestEqual(TEXT("Out of range is exact"), Read.GetBaseValue(), 1000.25f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,72 @@
+// Copyright 2020 Dan Kestranek.
+
+
+#include "GASSpawnPointSubsystem.h"
+#include "Engine/World.h"
+#include "GASSpawnPoint.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASSpawnPointSubsystemTest, "GAS.GameMode.SpawnPointSubsystem.RoundRobin",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGASSpawnPointSubsystemTest::RunTest(const FString& Parameters)
+{
+	// Actors aren't initialized in this world so spawn points don't register themselves
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	UGASSpawnPointSubsystem* SpawnPoints = World->GetSubsystem<UGASSpawnPointSubsystem>();
+	if (!TestNotNull(TEXT("Subsystem"), SpawnPoints))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	auto AddSpawnPoint = [World, SpawnPoints](FName Tag)
+	{
+		AGASSpawnPoint* SpawnPoint = World->SpawnActor<AGASSpawnPoint>();
+		SpawnPoint->PlayerStartTag = Tag;
+		SpawnPoints->RegisterSpawnPoint(SpawnPoint);
+		return SpawnPoint;
+	};
+
+	const FName HeroTag(TEXT("PlayerHero"));
+	const FName EnemyTag(TEXT("EnemyHero"));
+
+	AGASSpawnPoint* A = AddSpawnPoint(HeroTag);
+	AGASSpawnPoint* B = AddSpawnPoint(HeroTag);
+	AGASSpawnPoint* C = AddSpawnPoint(HeroTag);
+	AGASSpawnPoint* Enemy = AddSpawnPoint(EnemyTag);
+
+	// Registering twice doesn't add it twice
+	SpawnPoints->RegisterSpawnPoint(A);
+	TestEqual(TEXT("Hero spawn points"), SpawnPoints->GetNumSpawnPoints(HeroTag), 3);
+	TestEqual(TEXT("Enemy spawn points"), SpawnPoints->GetNumSpawnPoints(EnemyTag), 1);
+
+	TestTrue(TEXT("First"), SpawnPoints->FindSpawnPoint(HeroTag) == A);
+	TestTrue(TEXT("Second"), SpawnPoints->FindSpawnPoint(HeroTag) == B);
+	TestTrue(TEXT("Third"), SpawnPoints->FindSpawnPoint(HeroTag) == C);
+	TestTrue(TEXT("Wraps around"), SpawnPoints->FindSpawnPoint(HeroTag) == A);
+
+	TestTrue(TEXT("Tags have their own cursor"), SpawnPoints->FindSpawnPoint(EnemyTag) == Enemy);
+	TestTrue(TEXT("Single spawn point repeats"), SpawnPoints->FindSpawnPoint(EnemyTag) == Enemy);
+	TestNull(TEXT("Unknown tag"), SpawnPoints->FindSpawnPoint(TEXT("Minion")));
+
+	// Destroyed without EndPlay, skipped and dropped when the cursor reaches it
+	B->Destroy();
+	TestTrue(TEXT("Skips destroyed"), SpawnPoints->FindSpawnPoint(HeroTag) == C);
+	TestEqual(TEXT("Destroyed spawn point is dropped"), SpawnPoints->GetNumSpawnPoints(HeroTag), 2);
+	TestTrue(TEXT("Wraps around after removal"), SpawnPoints->FindSpawnPoint(HeroTag) == A);
+
+	SpawnPoints->UnregisterSpawnPoint(A);
+	TestTrue(TEXT("After unregister"), SpawnPoints->FindSpawnPoint(HeroTag) == C);
+	TestTrue(TEXT("Only one left"), SpawnPoints->FindSpawnPoint(HeroTag) == C);
+
+	SpawnPoints->UnregisterSpawnPoint(C);
+	TestNull(TEXT("None left"), SpawnPoints->FindSpawnPoint(HeroTag));
+
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
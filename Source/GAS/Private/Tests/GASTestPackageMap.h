@@ -0,0 +1,34 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/CoreNet.h"
+#include "GASTestPackageMap.generated.h"
+
+/**
+ * Package map for NetSerialize round trips in automation tests. Objects are written as their index in Objects,
+ * so a reader using the same map gets the same objects back without a net connection.
+ */
+UCLASS(Transient)
+class UGASTestPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<UObject*> Objects;
+
+	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override
+	{
+		int32 Index = Ar.IsSaving() ? Objects.AddUnique(Obj) : INDEX_NONE;
+		Ar << Index;
+
+		if (Ar.IsLoading())
+		{
+			Obj = Objects.IsValidIndex(Index) ? Objects[Index] : nullptr;
+		}
+
+		return true;
+	}
+};
@@ -2,4 +2,72 @@
 
 
 #include "..\..\Public\UI\GASDamageTextWidgetComponent.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/LatentActionManager.h"
+#include "Engine/World.h"
+#include "Player/GASPlayerController.h"
+#include "TimerManager.h"
 
+void UGASDamageTextWidgetComponent::FinishDamageText()
+{
+	DestroyComponent();
+}
+
+void UGASDamageTextWidgetComponent::DestroyComponent(bool bPromoteChildren)
+{
+	AGASPlayerController* PC = Cast<AGASPlayerController>(GetOwner());
+	if (PC && !PC->IsActorBeingDestroyed() && PC->ReleaseDamageText(this))
+	{
+		return;
+	}
+
+	Super::DestroyComponent(bPromoteChildren);
+}
+
+void UGASDamageTextWidgetComponent::ActivateDamageText(float Damage)
+{
+	// A recycled damage text may still be animating for its previous hit
+	StopDamageTextAnimation();
+
+	SetVisibility(true);
+	SetDamageText(Damage);
+
+	UWorld* World = GetWorld();
+	if (World && Lifetime > 0.0f)
+	{
+		World->GetTimerManager().SetTimer(LifetimeTimerHandle, this, &UGASDamageTextWidgetComponent::FinishDamageText, Lifetime, false);
+	}
+}
+
+void UGASDamageTextWidgetComponent::DeactivateDamageText()
+{
+	UWorld* World = GetWorld();
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(LifetimeTimerHandle);
+	}
+
+	StopDamageTextAnimation();
+
+	SetVisibility(false);
+	DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+}
+
+void UGASDamageTextWidgetComponent::StopDamageTextAnimation()
+{
+	UWorld* World = GetWorld();
+	UUserWidget* Widget = GetUserWidgetObject();
+	if (Widget)
+	{
+		Widget->StopAllAnimations();
+	}
+
+	if (World)
+	{
+		World->GetLatentActionManager().RemoveActionsForObject(this);
+		if (Widget)
+		{
+			World->GetLatentActionManager().RemoveActionsForObject(Widget);
+		}
+	}
+}
@@ -112,6 +112,15 @@ private:
 	void OnMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 	void OnGameplayEvent(FGameplayTag EventTag, const FGameplayEventData* Payload);
 
+	/** Dedicated server only. Starts timers for the montage's UGASAnimNotify_GameplayEvents, scaled by the play rate. */
+	void ScheduleMontageEvents();
+
+	void ClearScheduledMontageEvents();
+
+	void FireScheduledMontageEvent(FGameplayTag EventTag);
+
+	TArray<FTimerHandle> ScheduledEventTimers;
+
 	FOnMontageBlendingOutStarted BlendingOutDelegate;
 	FOnMontageEnded MontageEndedDelegate;
 	FDelegateHandle CancelledHandle;
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "Characters/Abilities/AttributeSets/GASPushModelAttributeSet.h"
+#include "Characters/Abilities/AttributeSets/GASQuantizedAttributeData.h"
 #include "GASAttributeSetBase.generated.h"
 
 // Uses macros from AttributeSet.h
@@ -14,11 +16,18 @@
 	GAMEPLAYATTRIBUTE_VALUE_SETTER(PropertyName) \
 	GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
 
+// Damage numbers owed to one source player, see GAS.AggregateDamage
+struct FGASPendingDamage
+{
+	TWeakObjectPtr<class AGASPlayerController> SourcePlayerController;
+	float Damage = 0.0f;
+};
+
 /**
  * 
  */
 UCLASS()
-class GAS_API UGASAttributeSetBase : public UAttributeSet
+class GAS_API UGASAttributeSetBase : public UGASPushModelAttributeSet
 {
 	GENERATED_BODY()
 	
@@ -35,47 +44,47 @@ public:
 	// Positive changes can directly use this.
 	// Negative changes to Health should go through Damage meta attribute.
 	UPROPERTY(BlueprintReadOnly, Category = "Health", ReplicatedUsing = OnRep_Health)
-	FGameplayAttributeData Health;
+	FGASVitalAttributeData Health;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, Health)
 
 	// MaxHealth is its own attribute since GameplayEffects may modify it
 	UPROPERTY(BlueprintReadOnly, Category = "Health", ReplicatedUsing = OnRep_MaxHealth)
-	FGameplayAttributeData MaxHealth;
+	FGASVitalAttributeData MaxHealth;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, MaxHealth)
 
 	// Health regen rate will passively increase Health every second
 	UPROPERTY(BlueprintReadOnly, Category = "Health", ReplicatedUsing = OnRep_HealthRegenRate)
-	FGameplayAttributeData HealthRegenRate;
+	FGASRateAttributeData HealthRegenRate;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, HealthRegenRate)
 
 	// Current Mana, used to execute special abilities. Capped by MaxMana.
 	UPROPERTY(BlueprintReadOnly, Category = "Mana", ReplicatedUsing = OnRep_Mana)
-	FGameplayAttributeData Mana;
+	FGASVitalAttributeData Mana;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, Mana)
 
 	// MaxMana is its own attribute since GameplayEffects may modify it
 	UPROPERTY(BlueprintReadOnly, Category = "Mana", ReplicatedUsing = OnRep_MaxMana)
-	FGameplayAttributeData MaxMana;
+	FGASVitalAttributeData MaxMana;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, MaxMana)
 
 	// Mana regen rate will passively increase Mana every second
 	UPROPERTY(BlueprintReadOnly, Category = "Mana", ReplicatedUsing = OnRep_ManaRegenRate)
-	FGameplayAttributeData ManaRegenRate;
+	FGASRateAttributeData ManaRegenRate;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, ManaRegenRate)
 
 	// Current stamina, used to execute special abilities. Capped by MaxStamina.
 	UPROPERTY(BlueprintReadOnly, Category = "Stamina", ReplicatedUsing = OnRep_Stamina)
-	FGameplayAttributeData Stamina;
+	FGASVitalAttributeData Stamina;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, Stamina)
 
 	// MaxStamina is its own attribute since GameplayEffects may modify it
 	UPROPERTY(BlueprintReadOnly, Category = "Stamina", ReplicatedUsing = OnRep_MaxStamina)
-	FGameplayAttributeData MaxStamina;
+	FGASVitalAttributeData MaxStamina;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, MaxStamina)
 
 	// Stamina regen rate will passively increase Stamina every second
 	UPROPERTY(BlueprintReadOnly, Category = "Stamina", ReplicatedUsing = OnRep_StaminaRegenRate)
-	FGameplayAttributeData StaminaRegenRate;
+	FGASRateAttributeData StaminaRegenRate;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, StaminaRegenRate)
 
 	// Armor reduces the amount of damage done by attackers
@@ -98,27 +107,29 @@ public:
 	FGameplayAttributeData CharacterLevel;
 	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, CharacterLevel)
 
-	// Experience points gained from killing enemies. Used to level up (not implemented in this project).
-	UPROPERTY(BlueprintReadOnly, Category = "XP", ReplicatedUsing = OnRep_XP)
-	FGameplayAttributeData XP;
-	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, XP)
+protected:
+	// Damage meta attribute execution: applies the damage to Health, plays hit reacts, shows damage numbers and gives bounties
+	void HandleDamage(const FGameplayEffectModCallbackData& Data);
+
+	void PlayHitReactOnTarget(class AGASCharacterMain* TargetCharacter, const FVector* HitLocation, class AGASCharacterMain* SourceCharacter);
 
-	// Experience points awarded to the character's killers. Used to level up (not implemented in this project).
-	UPROPERTY(BlueprintReadOnly, Category = "XP", ReplicatedUsing = OnRep_XPBounty)
-	FGameplayAttributeData XPBounty;
-	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, XPBounty)
+	void GiveBounty(UAbilitySystemComponent* Source, class AGASCharacterMain* TargetCharacter);
 
-	// Gold gained from killing enemies. Used to purchase items (not implemented in this project).
-	UPROPERTY(BlueprintReadOnly, Category = "Gold", ReplicatedUsing = OnRep_Gold)
-	FGameplayAttributeData Gold;
-	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, Gold)
+	// GAS.AggregateDamage: records a hit so its hit react, damage number and bounty are handled by FlushPendingDamage() next tick
+	void QueuePendingDamage(float DamageDone, const FHitResult* Hit, UAbilitySystemComponent* Source, AActor* SourceActor, AController* SourceController, class AGASCharacterMain* SourceCharacter,
+		AActor* TargetActor, AController* TargetController, class AGASCharacterMain* TargetCharacter);
 
-	// Gold awarded to the character's killer. Used to purchase items (not implemented in this project).
-	UPROPERTY(BlueprintReadOnly, Category = "Gold", ReplicatedUsing = OnRep_GoldBounty)
-	FGameplayAttributeData GoldBounty;
-	ATTRIBUTE_ACCESSORS(UGASAttributeSetBase, GoldBounty)
+	// Plays one hit react, shows one damage number per source player and gives the bounty at most once
+	void FlushPendingDamage();
+
+	// Server only state for GAS.AggregateDamage
+	TArray<FGASPendingDamage> PendingDamage;
+	TWeakObjectPtr<class AGASCharacterMain> PendingHitReactCauser;
+	TWeakObjectPtr<UAbilitySystemComponent> PendingKiller;
+	FVector PendingHitLocation;
+	bool bPendingHitLocationValid;
+	bool bPendingDamageFlushScheduled;
 
-protected:
 	// Helper function to proportionally adjust the value of an attribute when it's associated max attribute changes.
 	// (i.e. When MaxHealth increases, Health increases by an amount that maintains the same percentage as before)
 	void AdjustAttributeForMaxChange(FGameplayAttributeData& AffectedAttribute, const FGameplayAttributeData& MaxAttribute, float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty);
@@ -128,31 +139,31 @@ protected:
 	**/
 
 	UFUNCTION()
-	virtual void OnRep_Health(const FGameplayAttributeData& OldHealth);
+	virtual void OnRep_Health(const FGASVitalAttributeData& OldHealth);
 
 	UFUNCTION()
-	virtual void OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth);
+	virtual void OnRep_MaxHealth(const FGASVitalAttributeData& OldMaxHealth);
 
 	UFUNCTION()
-	virtual void OnRep_HealthRegenRate(const FGameplayAttributeData& OldHealthRegenRate);
+	virtual void OnRep_HealthRegenRate(const FGASRateAttributeData& OldHealthRegenRate);
 
 	UFUNCTION()
-	virtual void OnRep_Mana(const FGameplayAttributeData& OldMana);
+	virtual void OnRep_Mana(const FGASVitalAttributeData& OldMana);
 
 	UFUNCTION()
-	virtual void OnRep_MaxMana(const FGameplayAttributeData& OldMaxMana);
+	virtual void OnRep_MaxMana(const FGASVitalAttributeData& OldMaxMana);
 
 	UFUNCTION()
-	virtual void OnRep_ManaRegenRate(const FGameplayAttributeData& OldManaRegenRate);
+	virtual void OnRep_ManaRegenRate(const FGASRateAttributeData& OldManaRegenRate);
 
 	UFUNCTION()
-	virtual void OnRep_Stamina(const FGameplayAttributeData& OldStamina);
+	virtual void OnRep_Stamina(const FGASVitalAttributeData& OldStamina);
 
 	UFUNCTION()
-	virtual void OnRep_MaxStamina(const FGameplayAttributeData& OldMaxStamina);
+	virtual void OnRep_MaxStamina(const FGASVitalAttributeData& OldMaxStamina);
 
 	UFUNCTION()
-	virtual void OnRep_StaminaRegenRate(const FGameplayAttributeData& OldStaminaRegenRate);
+	virtual void OnRep_StaminaRegenRate(const FGASRateAttributeData& OldStaminaRegenRate);
 
 	UFUNCTION()
 	virtual void OnRep_Armor(const FGameplayAttributeData& OldArmor);
@@ -162,22 +173,4 @@ protected:
 
 	UFUNCTION()
 	virtual void OnRep_CharacterLevel(const FGameplayAttributeData& OldCharacterLevel);
-
-	UFUNCTION()
-	virtual void OnRep_XP(const FGameplayAttributeData& OldXP);
-
-	UFUNCTION()
-	virtual void OnRep_XPBounty(const FGameplayAttributeData& OldXPBounty);
-
-	UFUNCTION()
-	virtual void OnRep_Gold(const FGameplayAttributeData& OldGold);
-
-	UFUNCTION()
-	virtual void OnRep_GoldBounty(const FGameplayAttributeData& OldGoldBounty);
-
-private:
-	FGameplayTag HitDirectionFrontTag;
-	FGameplayTag HitDirectionBackTag;
-	FGameplayTag HitDirectionRightTag;
-	FGameplayTag HitDirectionLeftTag;
 };
@@ -0,0 +1,56 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "AbilitySystemComponent.h"
+#include "Characters/Abilities/AttributeSets/GASAttributeSetBase.h"
+#include "Characters/Abilities/AttributeSets/GASPushModelAttributeSet.h"
+#include "GASAttributeSetEconomy.generated.h"
+
+/**
+ * XP and Gold attributes. Only the PlayerState creates this set so Minions never allocate it.
+ * XP and Gold only replicate to the owning client (they are only shown on its HUD). Bounties are only read on the Server and never replicate.
+ */
+UCLASS()
+class GAS_API UGASAttributeSetEconomy : public UGASPushModelAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	UGASAttributeSetEconomy();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Experience points gained from killing enemies. Used to level up (not implemented in this project).
+	UPROPERTY(BlueprintReadOnly, Category = "XP", ReplicatedUsing = OnRep_XP)
+	FGameplayAttributeData XP;
+	ATTRIBUTE_ACCESSORS(UGASAttributeSetEconomy, XP)
+
+	// Experience points awarded to the character's killers. Server only, not replicated.
+	UPROPERTY(BlueprintReadOnly, Category = "XP")
+	FGameplayAttributeData XPBounty;
+	ATTRIBUTE_ACCESSORS(UGASAttributeSetEconomy, XPBounty)
+
+	// Gold gained from killing enemies. Used to purchase items (not implemented in this project).
+	UPROPERTY(BlueprintReadOnly, Category = "Gold", ReplicatedUsing = OnRep_Gold)
+	FGameplayAttributeData Gold;
+	ATTRIBUTE_ACCESSORS(UGASAttributeSetEconomy, Gold)
+
+	// Gold awarded to the character's killer. Server only, not replicated.
+	UPROPERTY(BlueprintReadOnly, Category = "Gold")
+	FGameplayAttributeData GoldBounty;
+	ATTRIBUTE_ACCESSORS(UGASAttributeSetEconomy, GoldBounty)
+
+protected:
+	/**
+	* These OnRep functions exist to make sure that the ability system internal representations are synchronized properly during replication
+	**/
+
+	UFUNCTION()
+	virtual void OnRep_XP(const FGameplayAttributeData& OldXP);
+
+	UFUNCTION()
+	virtual void OnRep_Gold(const FGameplayAttributeData& OldGold);
+};
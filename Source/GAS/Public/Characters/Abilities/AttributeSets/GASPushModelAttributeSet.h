@@ -0,0 +1,26 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GASPushModelAttributeSet.generated.h"
+
+/**
+ * Common base of this module's attribute sets. Their attributes are push model replicated,
+ * so every current or base value change marks the attribute's property dirty.
+ */
+UCLASS(Abstract)
+class GAS_API UGASPushModelAttributeSet : public UAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	// AttributeSet Overrides
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
+protected:
+	// Marks the attribute's property dirty so it gets sent on the next net update. Non-replicated (meta) attributes are ignored.
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute) const;
+};
@@ -0,0 +1,64 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GASQuantizedAttributeData.generated.h"
+
+/**
+ * Attribute data with a quantized wire format. The Server keeps full precision, clients receive values rounded to the
+ * type's step. Base and Current are only both sent when they differ, and values outside the type's range fall back
+ * to full floats so nothing is ever clamped by replication.
+ *
+ * Pick the type that matches the attribute's range and precision:
+ *  FGASVitalAttributeData - [0, 100000] in 0.1 steps (Health, Mana, Stamina and their Max values)
+ *  FGASRateAttributeData  - [-500, 500] in 0.01 steps (regen rates)
+ */
+USTRUCT(BlueprintType)
+struct GAS_API FGASVitalAttributeData : public FGameplayAttributeData
+{
+	GENERATED_BODY()
+
+	FGASVitalAttributeData()
+	{}
+
+	FGASVitalAttributeData(float DefaultValue)
+		: FGameplayAttributeData(DefaultValue)
+	{}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASVitalAttributeData> : public TStructOpsTypeTraitsBase2<FGASVitalAttributeData>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+USTRUCT(BlueprintType)
+struct GAS_API FGASRateAttributeData : public FGameplayAttributeData
+{
+	GENERATED_BODY()
+
+	FGASRateAttributeData()
+	{}
+
+	FGASRateAttributeData(float DefaultValue)
+		: FGameplayAttributeData(DefaultValue)
+	{}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASRateAttributeData> : public TStructOpsTypeTraitsBase2<FGASRateAttributeData>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
@@ -20,8 +20,46 @@ public:
 	bool bCharacterAbilitiesGiven = false;
 	bool bStartupEffectsApplied = false;
 
+	// Specs granted by AGASCharacterMain::AddCharacterAbilities() so they can be removed without searching the activatable abilities
+	TArray<FGameplayAbilitySpecHandle> CharacterAbilityHandles;
+
 	FReceivedDamageDelegate ReceivedDamage;
 
+	// Batch client ability RPCs (activate, target data, end) into one ServerAbilityRPCBatch where abilities allow it
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Ability|Network")
+	bool bBatchAbilityRPCs = true;
+
+	virtual bool ShouldDoServerAbilityRPCBatch() const override;
+
+	// Inactive abilities with UGASGameplayAbility::bBatchRPCs are activated through BatchRPCTryActivateAbility(), everything else goes to the engine's
+	virtual void AbilityLocalInputPressed(int32 InputID) override;
+
+	// Activates the ability inside an FScopedServerAbilityRPCBatcher so everything it sends to the Server in this scope goes in one RPC.
+	// If bEndAbilityImmediately, the ability is also ended inside the scope.
+	bool BatchRPCTryActivateAbility(FGameplayAbilitySpecHandle AbilityHandle, bool bEndAbilityImmediately);
+
+	// Overridden to count the ability RPCs sent to the Server in 'GAS Ability Server RPCs', a batch counts as one
+	virtual void CallServerTryActivateAbility(FGameplayAbilitySpecHandle AbilityToActivate, bool InputPressed, FPredictionKey PredictionKey) override;
+
+	virtual void CallServerEndAbility(FGameplayAbilitySpecHandle AbilityToEnd, FGameplayAbilityActivationInfo ActivationInfo, FPredictionKey PredictionKey) override;
+
+	virtual void EndServerAbilityRPCBatch(FGameplayAbilitySpecHandle AbilityHandle) override;
+
+	// True on the owning client while AbilityHandle's RPCs are being batched
+	bool IsServerAbilityRPCBatched(FGameplayAbilitySpecHandle AbilityHandle) const;
+
 	// Called from GDDamageExecCalculation. Broadcasts on ReceivedDamage whenever this ASC receives damage.
 	virtual void ReceiveDamage(UGASAbilitySystemComponent* SourceASC, float UnmitigatedDamage, float MitigatedDamage);
+
+	// Applies all the specs to this ASC in one batch. Aggregators dirtied by them are evaluated once at the end
+	// instead of after every spec, so attribute change delegates fire once per attribute.
+	TArray<FActiveGameplayEffectHandle> ApplyGameplayEffectSpecsToSelf(const TArray<FGameplayEffectSpecHandle>& Specs);
+
+	// Montage whose UGASAnimNotify_GameplayEvents are being fired from timers, see UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage
+	void SetScheduledEventsMontage(const UAnimMontage* Montage);
+
+	bool IsMontageEventScheduled(const UAnimMontage* Montage) const;
+
+protected:
+	TWeakObjectPtr<const UAnimMontage> ScheduledEventsMontage;
 };
@@ -0,0 +1,42 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotify.h"
+#include "GameplayTagContainer.h"
+#include "GASAnimNotify_GameplayEvent.generated.h"
+
+class UAnimMontage;
+
+// A UGASAnimNotify_GameplayEvent in a montage, at its time in the montage
+struct FGASMontageGameplayEvent
+{
+	float Time;
+	FGameplayTag EventTag;
+};
+
+/**
+ * Sends EventTag as a gameplay event to the owning actor, e.g. Event.Montage.SpawnProjectile.
+ * On dedicated servers with GAS.ServerMontageEvents enabled, UGASAT_PlayMontageAndWaitForEventT_WaitReceiveDamage fires these
+ * on timers from their times in the montage instead, so the server doesn't need to evaluate poses for notifies to trigger.
+ */
+UCLASS(meta = (DisplayName = "GAS Gameplay Event"))
+class GAS_API UGASAnimNotify_GameplayEvent : public UAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS")
+	FGameplayTag EventTag;
+
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	virtual FString GetNotifyName_Implementation() const override;
+
+	// True on dedicated servers when montage gameplay events are fired from timers instead of anim notifies
+	static bool UseServerMontageEvents(const UObject* WorldContextObject);
+
+	// This notify's events in Montage, sorted by time. Cached per world by UGASMontageCacheSubsystem.
+	static void GatherMontageEvents(const UAnimMontage* Montage, TArray<FGASMontageGameplayEvent>& OutEvents);
+};
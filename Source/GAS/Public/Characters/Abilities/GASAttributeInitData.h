@@ -0,0 +1,58 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Engine/DataAsset.h"
+#include "GASAttributeInitData.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+USTRUCT(BlueprintType)
+struct FGASAttributeInitValue
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS|Attributes")
+	FGameplayAttribute Attribute;
+
+	// Base value per character level. Index 0 is level 1. Levels past the end use the last value.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS|Attributes")
+	TArray<float> LevelValues;
+};
+
+/**
+ * Baked default attribute values for a character class. Applying it writes the base values straight into the attribute sets
+ * instead of building a context and spec and executing the DefaultAttributes GE.
+ * Put Max attributes before their current attribute, e.g. MaxHealth before Health, since changing a Max rescales its current value.
+ */
+UCLASS(BlueprintType)
+class GAS_API UGASAttributeInitData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS|Attributes")
+	TArray<FGASAttributeInitValue> Attributes;
+
+	// Server only. Sets every attribute's base value for Level. Returns false if there was nothing to apply or this isn't the Server.
+	// Clients get the values through attribute replication, setting them locally would overwrite newer replicated values.
+	bool ApplyToAbilitySystem(UAbilitySystemComponent* AbilitySystemComponent, int32 Level) const;
+
+#if WITH_EDITORONLY_DATA
+	// Instant GE to bake Attributes from, usually the character's DefaultAttributes. Only its Override modifiers with static magnitudes are baked.
+	UPROPERTY(EditAnywhere, Category = "GAS|Bake")
+	TSubclassOf<UGameplayEffect> SourceEffect;
+
+	UPROPERTY(EditAnywhere, Category = "GAS|Bake", meta = (ClampMin = 1))
+	int32 MaxLevel = 1;
+#endif
+
+#if WITH_EDITOR
+	// Rebuilds Attributes from SourceEffect for levels 1 to MaxLevel
+	UFUNCTION(CallInEditor, Category = "GAS|Bake")
+	void BakeFromSourceEffect();
+#endif
+};
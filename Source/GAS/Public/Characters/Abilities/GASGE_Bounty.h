@@ -0,0 +1,24 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "GASGE_Bounty.generated.h"
+
+/**
+ * Instant effect that adds XP and Gold to the target's GASAttributeSetEconomy. The amounts are SetByCaller magnitudes
+ * so the same effect (its CDO) is reused for every kill instead of creating a new UGameplayEffect each time.
+ */
+UCLASS()
+class GAS_API UGASGE_Bounty : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGASGE_Bounty();
+
+	// SetByCaller data names for the XP and Gold amounts
+	static const FName XPDataName;
+	static const FName GoldDataName;
+};
@@ -31,6 +31,21 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Ability")
 	bool ActivateAbilityOnGranted = false;
 
+	// When activated from input, send activation, target data and end (if bEndAbilityInRPCBatch) to the Server in one batched RPC
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Ability|Network")
+	bool bBatchRPCs = false;
+
+	// Ends the ability right after activating it inside the RPC batch. For hitscan style abilities that do all their work in ActivateAbility.
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Ability|Network", meta = (EditCondition = "bBatchRPCs"))
+	bool bEndAbilityInRPCBatch = false;
+
+	// Ends the ability from outside, e.g. from UGASAbilitySystemComponent::BatchRPCTryActivateAbility()
+	virtual void ExternalEndAbility();
+
+	// True during ActivateAbility() on the owning client when the batch will end the ability right after, so it shouldn't end itself.
+	// The Server and non batched activations have to end it themselves.
+	bool WillEndInRPCBatch() const;
+
 	// If an ability is marked as 'ActivateAbilityOnGranted', activate them immediately when given here
 	// Epic's comment: Projects may want to initiate passives or do other "BeginPlay" type of logic here.
 	virtual void OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
@@ -5,6 +5,7 @@
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
 #include "GAS/GAS.h"
+#include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
 #include "GASCharacterMain.generated.h"
 /**
@@ -16,6 +17,19 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCharacterBaseHitReactDelegate, EGASHitReactDirection, Direction);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCharacterDiedDelegate, AGASCharacterMain*, Character);
 
+// Latest hit react for a character. Counter changes on every hit so repeated hits from the same direction still replicate.
+USTRUCT()
+struct FGASHitReactInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    EGASHitReactDirection Direction = EGASHitReactDirection::None;
+
+    UPROPERTY()
+    uint8 Counter = 0;
+};
+
 UCLASS()
 class GAS_API AGASCharacterMain : public ACharacter, public IAbilitySystemInterface
 {
@@ -48,10 +62,11 @@ public:
     UFUNCTION(BlueprintCallable)
     EGASHitReactDirection GetHitReactDirection(const FVector& ImpactPoint);
 
-    UFUNCTION(NetMulticast, Reliable, WithValidation)
-    virtual void PlayHitReact(FGameplayTag HitDirection, AActor* DamageCauser);
-    virtual void PlayHitReact_Implementation(FGameplayTag HitDirection, AActor* DamageCauser);
-    virtual bool PlayHitReact_Validate(FGameplayTag HitDirection, AActor* DamageCauser);
+    // Server only. Hit reacts are cosmetic so they replicate as a property instead of a reliable multicast.
+    // Clients only get the latest hit react per net update.
+    virtual void PlayHitReact(EGASHitReactDirection HitDirection, AActor* DamageCauser);
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 
     /**
@@ -87,16 +102,58 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GAS|GASCharacter|Attributes")
     float GetMoveSpeedBaseValue() const;
 
+    // XP awarded to this character's killer. Reads GASAttributeSetEconomy if the ASC has one, 0 otherwise.
+    UFUNCTION(BlueprintCallable, Category = "GAS|GASCharacter|Attributes")
+    virtual float GetXPBounty() const;
+
+    // Gold awarded to this character's killer. Reads GASAttributeSetEconomy if the ASC has one, 0 otherwise.
+    UFUNCTION(BlueprintCallable, Category = "GAS|GASCharacter|Attributes")
+    virtual float GetGoldBounty() const;
+
 
     virtual void Die();
 
     UFUNCTION(BlueprintCallable, Category = "GAS|GASCharacter")
     virtual void FinishDying();
 
+    // Server only. Puts the character aside for reuse instead of destroying it. It is hidden, has no collision or movement,
+    // and all of its GEs and abilities are removed.
+    virtual void DeactivateCharacter();
+
+    // Server only. Brings a deactivated character back at SpawnTransform with fresh attributes, startup effects and abilities
+    // through ReinitializeAbilitySystem().
+    virtual void ReactivateCharacter(const FTransform& SpawnTransform);
+
+    // False while the character is deactivated and waiting to be reused
+    UFUNCTION(BlueprintCallable, Category = "GAS|GASCharacter")
+    bool IsCharacterActive() const;
+
+    // Server only. Called by UGASCharacterMovementComponent after every move so idle dormancy follows movement.
+    void OnServerMovementUpdated(bool bMoving);
+
 protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    UPROPERTY(ReplicatedUsing = OnRep_HitReact)
+    FGASHitReactInfo HitReact;
+
+    UFUNCTION()
+    virtual void OnRep_HitReact();
+
+    void BroadcastHitReact(EGASHitReactDirection HitDirection);
+
+    UPROPERTY(ReplicatedUsing = OnRep_CharacterActive)
+    bool bCharacterActive = true;
+
+    UFUNCTION()
+    virtual void OnRep_CharacterActive();
+
+    // Hides/shows the character and turns its collision and movement off/on to match bCharacterActive. Runs on Server and clients.
+    virtual void ApplyCharacterActiveState();
+
     // Instead of TWeakObjectPtrs, you could just have UPROPERTY() hard references or no references at all and just call
     // GetAbilitySystem() and make a GetAttributeSetBase() that can read from the PlayerState or from child classes.
     // Just make sure you test if the pointer is valid before using.
@@ -106,13 +163,6 @@ protected:
     TWeakObjectPtr<class UGASAbilitySystemComponent> AbilitySystemComponent;
     TWeakObjectPtr<class UGASAttributeSetBase> AttributeSetBase;
 
-    FGameplayTag HitDirectionFrontTag;
-    FGameplayTag HitDirectionBackTag;
-    FGameplayTag HitDirectionRightTag;
-    FGameplayTag HitDirectionLeftTag;
-    FGameplayTag DeadTag;
-    FGameplayTag EffectRemoveOnDeathTag;
-
     UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "GAS|GASCharacter")
     FText CharacterName;
 
@@ -124,11 +174,20 @@ protected:
      UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "GAS|Abilities")
      TArray<TSubclassOf<class UGASGameplayAbility>> CharacterAbilities;
 
+    // Keep CharacterAbilities granted through death instead of removing and regiving them on respawn.
+    // They can't activate while dead because UGASGameplayAbility is blocked by State.Dead, which Die() replicates to clients.
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Abilities")
+    bool bKeepAbilitiesOnDeath = false;
+
     // Default attributes for a character for initializing on spawn/respawn.
     // This is an instant GE that overrides the values for attributes that get reset on spawn/respawn.
     UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "GAS|Abilities")
     TSubclassOf<class UGameplayEffect> DefaultAttributes;
 
+    // Baked default attribute values. Used instead of DefaultAttributes when set, which stays as the fallback.
+    UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "GAS|Abilities")
+    class UGASAttributeInitData* AttributeInitData;
+
     // These effects are only applied one time on startup
     UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "GAS|Abilities")
     TArray<TSubclassOf<class UGameplayEffect>> StartupEffects;
@@ -136,13 +195,69 @@ protected:
     // Grant abilities on the Server. The Ability Specs will be replicated to the owning client.
     virtual void AddCharacterAbilities();
 
-    // Initialize the Character's attributes. Must run on Server but we run it on Client too
-    // so that we don't have to wait. The Server's replication to the Client won't matter since
-    // the values should be the same.
+    // Initialize the Character's attributes. The baked AttributeInitData path is Server only, clients get those values from replication.
+    // The DefaultAttributes GE fallback still runs on the Client too so that it doesn't have to wait.
     virtual void InitializeAttributes();
 
     virtual void AddStartupEffects();
 
+    // Server only. Called by ReactivateCharacter(): clears the Dead tag, resets attributes and reapplies startup effects and abilities.
+    virtual void ReinitializeAbilitySystem();
+
+    // Points the movement component at the current ASC so it can cache MoveSpeed and the movement blocking tags.
+    // Call whenever AbilitySystemComponent is (re)assigned.
+    virtual void BindMovementToAbilitySystem();
+
+    // Server only. Puts the character to net dormancy while it is dead or deactivated. AI controlled characters also go dormant
+    // while stunned with no periodic effects, or standing still and out of combat for OutOfCombatDormancyDelay.
+    // Any GE, ability activation, dead or stun tag change or attribute change on its ASC wakes it, or only flushes it while dead or stunned.
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Replication")
+    bool bAutoNetDormancy = true;
+
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Replication", Meta = (EditCondition = "bAutoNetDormancy"))
+    float OutOfCombatDormancyDelay = 10.0f;
+
+    // How long the character has to stand still before it can go dormant, so stop and go movement doesn't flip dormancy every few frames
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Replication", Meta = (EditCondition = "bAutoNetDormancy"))
+    float StillDormancyDelay = 0.5f;
+
+    float LastCombatActivityTime = 0.0f;
+
+    float LastMovingTime = 0.0f;
+
+    // Not moving for at least StillDormancyDelay
+    bool IsStillForDormancy() const;
+
+    FTimerHandle OutOfCombatTimerHandle;
+
+    // The ASC the net dormancy callbacks are bound to, automatic dormancy is off until it is set
+    TWeakObjectPtr<class UAbilitySystemComponent> NetDormancyAbilitySystemComponent;
+
+    // Server only. Call whenever AbilitySystemComponent is (re)assigned, after its attributes are initialized.
+    virtual void BindNetDormancyToAbilitySystem();
+
+    bool UsesAutoNetDormancy() const;
+
+    // Deactivated, or dead or stunned with nothing periodic that would change it and not moving. Activity only flushes these.
+    bool ShouldStayNetDormant() const;
+
+    bool ShouldBeNetDormant() const;
+
+    // Goes dormant or wakes up to match ShouldBeNetDormant()
+    void UpdateNetDormancy();
+
+    void NotifyCombatActivity();
+
+    void OutOfCombatTimerExpired();
+
+    void NetDormancyEffectApplied(UAbilitySystemComponent* Target, const struct FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+
+    void NetDormancyAbilityActivated(class UGameplayAbility* Ability);
+
+    void NetDormancyTagChanged(const FGameplayTag CallbackTag, int32 NewCount);
+
+    void NetDormancyAttributeChanged(const FOnAttributeChangeData& Data);
+
 
     /**
     * Setters for Attributes. Only use these in special cases like Respawning, otherwise use a GE to change Attributes.
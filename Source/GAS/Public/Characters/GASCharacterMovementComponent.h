@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameplayEffectTypes.h"
 #include "GASCharacterMovementComponent.generated.h"
 
 /**
@@ -65,9 +66,16 @@ public:
 	uint8 RequestToStartSprinting : 1;
 	uint8 RequestToStartADS : 1;
 
+	// Returns the cached effective max speed. The cache is only updated by MoveSpeed, Health reaching or leaving 0, Stun/Dead tag and sprint/ADS changes.
 	virtual float GetMaxSpeed() const override;
 	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
 	virtual class FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Listens to the MoveSpeed and Health attributes and Stun/Dead tags on the ASC to keep the cached max speed up to date.
+	// Call again whenever the owner's AbilitySystemComponent changes (e.g. on possession).
+	void BindToAbilitySystem(class UAbilitySystemComponent* InAbilitySystemComponent);
 
 	// Sprint
 	UFUNCTION(BlueprintCallable, Category = "Sprint")
@@ -80,4 +88,36 @@ public:
 	void StartAimDownSights();
 	UFUNCTION(BlueprintCallable, Category = "Aim Down Sights")
 	void StopAimDownSights();
+
+protected:
+	// False when the owner is not an AGASCharacterMain, in which case GetMaxSpeed() falls back to the engine behavior
+	bool bUseCachedMaxSpeed;
+
+	float CachedMaxSpeed;
+
+	float CachedMoveSpeed;
+
+	float CachedHealth;
+
+	bool bMovementBlockedByTags;
+
+	TWeakObjectPtr<class UAbilitySystemComponent> BoundAbilitySystemComponent;
+
+	FDelegateHandle MoveSpeedChangedDelegateHandle;
+	FDelegateHandle HealthChangedDelegateHandle;
+	FDelegateHandle StunTagChangedDelegateHandle;
+	FDelegateHandle DeadTagChangedDelegateHandle;
+
+	virtual void PerformMovement(float DeltaTime) override;
+
+	void UnbindFromAbilitySystem();
+
+	// Recomputes CachedMaxSpeed from the cached MoveSpeed, blocking tags and sprint/ADS flags
+	void UpdateCachedMaxSpeed();
+
+	void MoveSpeedChanged(const FOnAttributeChangeData& Data);
+
+	void HealthChanged(const FOnAttributeChangeData& Data);
+
+	void BlockingTagChanged(const FGameplayTag CallbackTag, int32 NewCount);
 };
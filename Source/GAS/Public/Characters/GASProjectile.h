@@ -7,6 +7,67 @@
 #include "GameplayEffect.h"
 #include "GASProjectile.generated.h"
 
+// Compact spawn event for a projectile simulated by UGASProjectileSubsystem. Clients simulate it from these values.
+USTRUCT()
+struct FGASProjectileSpawn
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<class AGASProjectile> ProjectileClass;
+
+	// Null on clients the instigator isn't relevant to
+	UPROPERTY()
+	class AGASCharacterMain* Instigator = nullptr;
+
+	UPROPERTY()
+	FVector Origin = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Velocity = FVector::ZeroVector;
+
+	UPROPERTY()
+	float Range = 0.0f;
+
+	// Unique per server, identifies the projectile in later events
+	UPROPERTY()
+	uint32 ProjectileId = 0;
+
+	// Activation prediction key of the ability that fired it, matches the owning client's predicted projectile. 0 if not predicted.
+	UPROPERTY()
+	int16 PredictionKey = 0;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASProjectileSpawn> : public TStructOpsTypeTraitsBase2<FGASProjectileSpawn>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+// Replicated state of a pooled projectile actor. Counter changes on every activation so reuse is always seen by clients.
+USTRUCT()
+struct FGASProjectilePoolState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bActive = true;
+
+	UPROPERTY()
+	uint8 Counter = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location;
+
+	UPROPERTY()
+	FVector_NetQuantize Velocity;
+};
+
 UCLASS()
 class GAS_API AGASProjectile : public AActor
 {
@@ -25,7 +86,65 @@ public:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere)
 	class UProjectileMovementComponent* ProjectileMovement;
 
+	// Spawn this projectile as an actor even if it could be simulated by UGASProjectileSubsystem,
+	// e.g. when its Blueprint has logic or components that the subsystem doesn't reproduce.
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Simulation")
+	bool bRequiresActor;
+
+	// Drawn for this projectile by UGASProjectileSubsystem. Projectiles without one are always spawned as actors.
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Simulation")
+	class UStaticMesh* SimulatedMesh;
+
+	// Sphere swept by UGASProjectileSubsystem for collision
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "GAS|Simulation")
+	float SimulatedRadius;
+
+	// True if UGASProjectileSubsystem can simulate ProjectileClass instead of spawning an actor for it
+	static bool CanBeSimulated(TSubclassOf<AGASProjectile> ProjectileClass);
+
+	// Server only. Called by UGASProjectileSubsystem when this projectile is reused.
+	void ActivateFromPool(const FTransform& SpawnTransform, float NewRange, const FGameplayEffectSpecHandle& NewDamageEffectSpecHandle);
+
+	// Server only. Hides the projectile and puts it to net dormancy until it is reused.
+	void DeactivateToPool();
+
+	bool IsActiveInPool() const;
+
+	// Pooled projectiles go back to the pool instead of being destroyed, also from the Blueprint DestroyActor node
+	virtual void K2_DestroyActor() override;
+
+	virtual void LifeSpanExpired() override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Server only. True if HitLocation was on HitActor's capsule where the instigating client saw it,
+	// call before applying damage from a Blueprint hit or overlap. Always true for actors that aren't characters.
+	// Characters without recorded history are checked against their current capsule.
+	UFUNCTION(BlueprintCallable, Category = "GAS|Projectile")
+	bool ValidateHit(AActor* HitActor, FVector HitLocation) const;
+
+	// Set by UGASProjectileSubsystem for projectiles it pools
+	bool bPooled;
+
 protected:
+	// Server only, how far back in time the instigator's hits are validated
+	float RewindOffset;
+
+	void UpdateRewindOffset();
+
+	UPROPERTY(ReplicatedUsing = OnRep_PoolState)
+	FGASProjectilePoolState PoolState;
+
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+
+	UFUNCTION()
+	void OnRep_PoolState();
+
+	// Shows or hides the projectile and starts or stops its movement to match PoolState. Runs on Server and clients.
+	void ApplyPoolState();
+
+	// BeginPlay only runs once for pooled projectiles. Reset Blueprint state here, e.g. the start location used for Range.
+	UFUNCTION(BlueprintImplementableEvent, Category = "GAS|Projectile")
+	void OnActivatedFromPool();
 };
@@ -49,4 +49,7 @@ protected:
 
 	UFUNCTION()
 	void EventReceived(FGameplayTag EventTag, FGameplayEventData EventData);
+
+	// Spawns the projectile on the Server and predicts it on the owning client. False if the avatar isn't a hero.
+	bool FireProjectile();
 };
@@ -37,6 +37,11 @@ public:
 
 	USkeletalMeshComponent* GetGunComponent() const;
 
+	// World transform of the gun's Muzzle socket. On dedicated servers that skip bone refresh (GAS.ServerMontageEvents),
+	// this is the muzzle offset from the actor for the current montage frame, measured once per hero class, mesh and gun with a forced
+	// pose update and cached in UGASMontageCacheSubsystem.
+	FTransform GetMuzzleTransform();
+
 	virtual void FinishDying() override;
 
 protected:
@@ -72,11 +77,11 @@ protected:
 
 	bool ASCInputBound = false;
 
-	FGameplayTag DeadTag;
-
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void ReinitializeAbilitySystem() override;
+
 	virtual void PostInitializeComponents() override;
 
 	// Mouse
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Characters/GASCharacterMain.h"
 #include "GameplayEffectTypes.h"
+#include "AttributeSet.h"
 #include "GASMinionCharacter.generated.h"
 
 /**
@@ -18,6 +19,13 @@ class GAS_API AGASMinionCharacter : public AGASCharacterMain
 public:
 	AGASMinionCharacter(const class FObjectInitializer& ObjectInitializer);
 
+	// Minions don't have an economy attribute set, their bounties come from the curves below
+	virtual float GetXPBounty() const override;
+	virtual float GetGoldBounty() const override;
+
+	// Returns the minion to the UGASMinionPoolSubsystem instead of destroying it
+	virtual void FinishDying() override;
+
 protected:
 
 	// Actual hard pointer to AbilitySystemComponent
@@ -29,6 +37,14 @@ protected:
 	class UGASAttributeSetBase* HardRefAttributeSetBase;
 	
 	virtual void BeginPlay() override;
+
+	// XP awarded to this minion's killer, scaled by CharacterLevel
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Gas|Bounty")
+	FScalableFloat XPBounty;
+
+	// Gold awarded to this minion's killer, scaled by CharacterLevel
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Gas|Bounty")
+	FScalableFloat GoldBounty;
 	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gas|UI")
 	TSubclassOf<class UGASFloatingStatusBarWidget> UIFloatingStatusBarClass;
@@ -6,6 +6,8 @@
 #include "Player/GASPlayerController.h"
 #include "Player/GASPlayerState.h"
 #include "GameFramework/SpectatorPawn.h"
+#include "GASSpawnPoint.h"
+#include "GASSpawnPointSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 #include "UObject/ConstructorHelpers.h"
@@ -14,6 +16,9 @@ AGASGameMode::AGASGameMode()
 {
 	RespawnDelay = 5.0f;
 
+	PlayerHeroSpawnTag = FName("PlayerHero");
+	EnemyHeroSpawnTag = FName("EnemyHero");
+
 	HeroClass = StaticLoadClass(UObject::StaticClass(), nullptr, TEXT("/Game/Gas/Characters/Hero/BP_HeroCharacter.BP_HeroCharacter_C"));
 	if (!HeroClass)
 	{
@@ -23,9 +28,21 @@ AGASGameMode::AGASGameMode()
 
 void AGASGameMode::HeroDied(AController* Controller)
 {
-	FActorSpawnParameters SpawnParameters;
-	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-	ASpectatorPawn* SpectatorPawn = GetWorld()->SpawnActor<ASpectatorPawn>(SpectatorClass, Controller->GetPawn()->GetActorTransform(), SpawnParameters);
+	if (!Controller)
+	{
+		return;
+	}
+
+	AGASHeroCharacter* Hero = Cast<AGASHeroCharacter>(Controller->GetPawn());
+	if (!Hero)
+	{
+		return;
+	}
+
+	// The hero deactivates itself in FinishDying and waits here to be respawned
+	DeadHeroes.Add(Controller, Hero);
+
+	ASpectatorPawn* SpectatorPawn = GetOrCreateSpectatorPawn(Controller, Hero->GetActorTransform());
 
 	Controller->UnPossess();
 	Controller->Possess(SpectatorPawn);
@@ -43,51 +60,129 @@ void AGASGameMode::HeroDied(AController* Controller)
 	}
 }
 
-void AGASGameMode::BeginPlay()
+void AGASGameMode::Logout(AController* Exiting)
+{
+	AGASHeroCharacter* DeadHero = nullptr;
+	if (DeadHeroes.RemoveAndCopyValue(Exiting, DeadHero) && IsValid(DeadHero))
+	{
+		DeadHero->Destroy();
+	}
+
+	ASpectatorPawn* SpectatorPawn = nullptr;
+	if (SpectatorPawns.RemoveAndCopyValue(Exiting, SpectatorPawn) && IsValid(SpectatorPawn))
+	{
+		SpectatorPawn->Destroy();
+	}
+
+	Super::Logout(Exiting);
+}
+
+AActor* AGASGameMode::ChoosePlayerStart_Implementation(AController* Player)
 {
-	Super::BeginPlay();
+	UGASSpawnPointSubsystem* SpawnPoints = GetWorld()->GetSubsystem<UGASSpawnPointSubsystem>();
+	AGASSpawnPoint* SpawnPoint = SpawnPoints ? SpawnPoints->FindSpawnPoint(PlayerHeroSpawnTag) : nullptr;
+	if (SpawnPoint)
+	{
+		return SpawnPoint;
+	}
+
+	return Super::ChoosePlayerStart_Implementation(Player);
+}
+
+bool AGASGameMode::ShouldSpawnAtStartSpot_Implementation(AController* Player)
+{
+	return false;
+}
+
+AActor* AGASGameMode::FindEnemyHeroSpawnPoint()
+{
+	UGASSpawnPointSubsystem* SpawnPoints = GetWorld()->GetSubsystem<UGASSpawnPointSubsystem>();
+	AGASSpawnPoint* SpawnPoint = SpawnPoints ? SpawnPoints->FindSpawnPoint(EnemyHeroSpawnTag) : nullptr;
+	if (SpawnPoint)
+	{
+		return SpawnPoint;
+	}
 
-	// Get the enemy hero spawn point
-	TArray<AActor*> Actors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), Actors);
-	for (AActor* Actor : Actors)
+	if (!IsValid(LegacyEnemySpawnPoint))
 	{
-		if (Actor->GetName() == FString("EnemyHeroSpawn"))
+		// Name lookup in each level's object hash, no actor iteration
+		for (ULevel* Level : GetWorld()->GetLevels())
 		{
-			EnemySpawnPoint = Actor;
-			break;
+			LegacyEnemySpawnPoint = Cast<AActor>(StaticFindObjectFast(AActor::StaticClass(), Level, FName("EnemyHeroSpawn")));
+			if (LegacyEnemySpawnPoint)
+			{
+				break;
+			}
 		}
 	}
+
+	return LegacyEnemySpawnPoint;
 }
 
 void AGASGameMode::RespawnHero(AController * Controller)
 {
+	if (!IsValid(Controller))
+	{
+		return;
+	}
+
+	FTransform SpawnTransform;
+
 	if (Controller->IsPlayerController())
 	{
 		// Respawn player hero
 		AActor* PlayerStart = FindPlayerStart(Controller);
+		SpawnTransform = FTransform(PlayerStart->GetActorRotation(), PlayerStart->GetActorLocation());
+	}
+	else
+	{
+		// Respawn AI hero
+		AActor* EnemySpawnPoint = FindEnemyHeroSpawnPoint();
+		if (!EnemySpawnPoint)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s() No spawn point for enemy heroes. Add an AGASSpawnPoint with PlayerStartTag %s."), *FString(__FUNCTION__), *EnemyHeroSpawnTag.ToString());
+			return;
+		}
 
-		FActorSpawnParameters SpawnParameters;
-		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		SpawnTransform = EnemySpawnPoint->GetActorTransform();
+	}
 
-		AGASHeroCharacter* Hero = GetWorld()->SpawnActor<AGASHeroCharacter>(HeroClass, PlayerStart->GetActorLocation(), PlayerStart->GetActorRotation(), SpawnParameters);
+	AGASHeroCharacter* Hero = GetOrCreateHero(Controller, SpawnTransform);
+
+	// The spectator pawn is left where it is and reused the next time this controller dies
+	Controller->UnPossess();
+	Controller->Possess(Hero);
+}
 
-		APawn* OldSpectatorPawn = Controller->GetPawn();
-		Controller->UnPossess();
-		OldSpectatorPawn->Destroy();
-		Controller->Possess(Hero);
+ASpectatorPawn* AGASGameMode::GetOrCreateSpectatorPawn(AController* Controller, const FTransform& SpawnTransform)
+{
+	ASpectatorPawn* SpectatorPawn = SpectatorPawns.FindRef(Controller);
+	if (IsValid(SpectatorPawn))
+	{
+		SpectatorPawn->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+		return SpectatorPawn;
 	}
-	else
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	SpectatorPawn = GetWorld()->SpawnActor<ASpectatorPawn>(SpectatorClass, SpawnTransform, SpawnParameters);
+
+	SpectatorPawns.Add(Controller, SpectatorPawn);
+	return SpectatorPawn;
+}
+
+AGASHeroCharacter* AGASGameMode::GetOrCreateHero(AController* Controller, const FTransform& SpawnTransform)
+{
+	AGASHeroCharacter* Hero = nullptr;
+	if (DeadHeroes.RemoveAndCopyValue(Controller, Hero) && IsValid(Hero))
 	{
-		// Respawn AI hero
-		FActorSpawnParameters SpawnParameters;
-		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-		AGASHeroCharacter* Hero = GetWorld()->SpawnActor<AGASHeroCharacter>(HeroClass, EnemySpawnPoint->GetActorTransform(), SpawnParameters);
-		
-		APawn* OldSpectatorPawn = Controller->GetPawn();
-		Controller->UnPossess();
-		OldSpectatorPawn->Destroy();
-		Controller->Possess(Hero);
+		// Only moves and shows the hero, possession right after this initializes the ASC the same as for a new hero
+		Hero->ReactivateCharacter(SpawnTransform);
+		return Hero;
 	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	return GetWorld()->SpawnActor<AGASHeroCharacter>(HeroClass, SpawnTransform, SpawnParameters);
 }
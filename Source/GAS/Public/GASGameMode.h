@@ -16,14 +16,43 @@ public:
 
 	void HeroDied(AController* Controller);
 
+	virtual void Logout(AController* Exiting) override;
+
 protected:
 	float RespawnDelay;
 
 	TSubclassOf<class AGASHeroCharacter> HeroClass;
 
-	AActor* EnemySpawnPoint;
+	// AGASSpawnPoint PlayerStartTags for player heroes and AI enemy heroes
+	UPROPERTY(EditDefaultsOnly, Category = "GAS|Spawning")
+	FName PlayerHeroSpawnTag;
+
+	UPROPERTY(EditDefaultsOnly, Category = "GAS|Spawning")
+	FName EnemyHeroSpawnTag;
+
+	// Maps without AGASSpawnPoints have an actor named "EnemyHeroSpawn" instead. Looked up by name on first use.
+	UPROPERTY()
+	AActor* LegacyEnemySpawnPoint;
+
+	// Dead heroes kept around (deactivated) so that respawning reuses them instead of spawning a new one
+	UPROPERTY()
+	TMap<AController*, class AGASHeroCharacter*> DeadHeroes;
+
+	// One spectator pawn per controller, reused every time its hero dies
+	UPROPERTY()
+	TMap<AController*, class ASpectatorPawn*> SpectatorPawns;
 
-	virtual void BeginPlay() override;
+	virtual AActor* ChoosePlayerStart_Implementation(AController* Player) override;
+
+	// Always go through ChoosePlayerStart so respawns use the spawn point round robin instead of the controller's first StartSpot
+	virtual bool ShouldSpawnAtStartSpot_Implementation(AController* Player) override;
 
 	void RespawnHero(AController* Controller);
+
+	AActor* FindEnemyHeroSpawnPoint();
+
+	class ASpectatorPawn* GetOrCreateSpectatorPawn(AController* Controller, const FTransform& SpawnTransform);
+
+	// Reactivates the dead hero kept for this controller, or spawns a new one if there isn't one
+	class AGASHeroCharacter* GetOrCreateHero(AController* Controller, const FTransform& SpawnTransform);
 };
@@ -0,0 +1,42 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Singleton containing the native gameplay tags used by C++ code in this module.
+ * Tags are resolved once from the tag table in InitializeNativeTags() (called from UGASEngineSubsystem::Initialize)
+ * so runtime code never has to look a tag up by name.
+ */
+struct GAS_API FGASGameplayTags
+{
+public:
+	static const FGASGameplayTags& Get() { return GameplayTags; }
+
+	// Resolves every native tag. Fatal error if a tag is missing from the tag table.
+	static void InitializeNativeTags();
+
+	FGameplayTag Ability;
+	FGameplayTag Ability_NotCanceledByStun;
+
+	FGameplayTag Data_Damage;
+
+	FGameplayTag Effect_RemoveOnDeath;
+
+	FGameplayTag Event_Montage_EndAbility;
+	FGameplayTag Event_Montage_SpawnProjectile;
+
+	FGameplayTag State_AimDownSights;
+	FGameplayTag State_AimDownSights_Removal;
+	FGameplayTag State_Dead;
+	FGameplayTag State_Debuff_Stun;
+
+protected:
+	void AddAllTags();
+	void AddTag(FGameplayTag& OutTag, const ANSICHAR* TagName);
+
+private:
+	static FGASGameplayTags GameplayTags;
+};
@@ -0,0 +1,111 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GASLagCompensationSubsystem.generated.h"
+
+class AGASCharacterMain;
+
+// Capsules of every registered character at one server time. Each array is indexed by character slot and
+// laid out contiguously so the broad phase is a flat loop over floats. Radius 0 marks an empty or dead slot.
+struct FGASCapsuleSnapshot
+{
+	double Time = 0.0;
+
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+	TArray<float> Radius;
+	TArray<float> HalfHeight;
+
+	int32 Num() const { return X.Num(); }
+
+	void SetNum(int32 NumSlots);
+};
+
+struct FGASRewindHit
+{
+	int32 Slot = INDEX_NONE;
+
+	// Fraction along the trace, 0 at Start and 1 at End
+	float Time = 1.0f;
+
+	FVector Location = FVector::ZeroVector;
+
+	FVector Normal = FVector::ZeroVector;
+};
+
+/**
+ * Server side history of character capsules, recorded every frame into a fixed size ring buffer.
+ * Hits can then be traced against the capsules where the instigating client saw them instead of where they are now.
+ * Characters register themselves on BeginPlay. Capsules are upright so only their center, radius and half height are kept.
+ */
+UCLASS()
+class GAS_API UGASLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual bool IsTickable() const override;
+
+	void RegisterCharacter(AGASCharacterMain* Character);
+
+	void UnregisterCharacter(AGASCharacterMain* Character);
+
+	// Server time that the controlling client of Instigator saw when it acted, from its ping. Current time for AI.
+	double GetRewindTime(const AActor* Instigator) const;
+
+	// Sweeps a sphere of SweepRadius from Start to End against the capsules at Time and returns the nearest hit.
+	// Only reads the history, safe to call from worker threads while the game thread isn't recording.
+	bool RewindTrace(const FVector& Start, const FVector& End, float SweepRadius, double Time, int32 IgnoreSlot, FGASRewindHit& OutHit) const;
+
+	// True if Location is within Tolerance of Target's capsule at Time.
+	// Without a recorded capsule for Target, e.g. right after it spawned, it is checked against its current capsule instead.
+	UFUNCTION(BlueprintCallable, Category = "GAS|LagCompensation")
+	bool ValidateHit(AGASCharacterMain* Target, FVector Location, double Time, float Tolerance = 10.0f) const;
+
+	// True if Location is within Tolerance of Target's current capsule, for hits that can't be rewound
+	static bool ValidateLiveHit(const AGASCharacterMain* Target, const FVector& Location, float Tolerance);
+
+	// True if Location is within Tolerance of the upright capsule at Center. HalfHeight includes the hemispheres.
+	static bool IsNearCapsule(const FVector& Location, const FVector& Center, float Radius, float HalfHeight, float Tolerance);
+
+	// Sweeps a sphere of SweepRadius from Start to End against the upright capsule at Center. OutTime is the fraction along
+	// the sweep where it first touches, OutLocation the sphere's center there and OutNormal points from the capsule's axis to it.
+	static bool SweepCapsule(const FVector& Start, const FVector& End, float SweepRadius, const FVector& Center, float Radius, float HalfHeight,
+		float& OutTime, FVector& OutLocation, FVector& OutNormal);
+
+	// INDEX_NONE if Character isn't registered
+	int32 GetCharacterSlot(const AActor* Character) const;
+
+	AGASCharacterMain* GetCharacterInSlot(int32 Slot) const;
+
+	bool HasHistory() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Ring buffer, NextSnapshot is overwritten next
+	TArray<FGASCapsuleSnapshot> History;
+	int32 NextSnapshot = 0;
+	int32 NumSnapshots = 0;
+
+	TArray<TWeakObjectPtr<AGASCharacterMain>> SlotCharacters;
+	TArray<int32> FreeSlots;
+	TMap<TObjectKey<AActor>, int32> CharacterSlots;
+
+	void RecordSnapshot();
+
+	// Finds the two snapshots around Time and how far between them Time is. Clamps to the oldest and newest.
+	bool FindSnapshots(double Time, const FGASCapsuleSnapshot*& OutOlder, const FGASCapsuleSnapshot*& OutNewer, float& OutAlpha) const;
+};
@@ -0,0 +1,59 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GASMinionPoolSubsystem.generated.h"
+
+class AGASMinionCharacter;
+
+USTRUCT()
+struct FGASMinionPool
+{
+	GENERATED_BODY()
+
+	// Deactivated minions ready to be reused
+	UPROPERTY()
+	TArray<AGASMinionCharacter*> Minions;
+};
+
+/**
+ * Server side pool of minions. Dead minions are deactivated and handed out again by SpawnMinion() instead of being destroyed,
+ * so spawning a wave doesn't pay for actor, ASC and attribute set creation again.
+ */
+UCLASS()
+class GAS_API UGASMinionPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Reuses a pooled minion of MinionClass if there is one, otherwise spawns a new one. Server only.
+	UFUNCTION(BlueprintCallable, Category = "GAS|MinionPool")
+	AGASMinionCharacter* SpawnMinion(TSubclassOf<AGASMinionCharacter> MinionClass, const FTransform& SpawnTransform);
+
+	// Deactivates the minion and keeps it for reuse. Server only.
+	// Returns false if the minion wasn't pooled (pool for its class is full), the caller should destroy it.
+	UFUNCTION(BlueprintCallable, Category = "GAS|MinionPool")
+	bool ReleaseMinion(AGASMinionCharacter* Minion);
+
+	// Spawns Count minions of MinionClass straight into the pool, e.g. during loading so the first wave doesn't allocate
+	UFUNCTION(BlueprintCallable, Category = "GAS|MinionPool")
+	void Prewarm(TSubclassOf<AGASMinionCharacter> MinionClass, int32 Count);
+
+	UFUNCTION(BlueprintCallable, Category = "GAS|MinionPool")
+	int32 GetNumPooledMinions(TSubclassOf<AGASMinionCharacter> MinionClass) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AGASMinionCharacter>, FGASMinionPool> Pools;
+
+	// Dead minions beyond this many per class are destroyed instead of pooled
+	int32 MaxPooledMinionsPerClass = 200;
+
+	AGASMinionCharacter* SpawnNewMinion(TSubclassOf<AGASMinionCharacter> MinionClass, const FTransform& SpawnTransform);
+};
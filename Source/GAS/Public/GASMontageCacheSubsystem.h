@@ -0,0 +1,73 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Characters/Abilities/GASAnimNotify_GameplayEvent.h"
+#include "GASMontageCacheSubsystem.generated.h"
+
+class UAnimMontage;
+
+// Everything that moves the muzzle relative to the actor at one montage frame
+struct FGASMuzzleOffsetKey
+{
+	FObjectKey CharacterClass;
+	FObjectKey Mesh;
+	FObjectKey Gun;
+	FObjectKey Montage;
+	int32 Frame = 0;
+
+	bool operator==(const FGASMuzzleOffsetKey& Other) const
+	{
+		return CharacterClass == Other.CharacterClass && Mesh == Other.Mesh && Gun == Other.Gun && Montage == Other.Montage && Frame == Other.Frame;
+	}
+
+	friend uint32 GetTypeHash(const FGASMuzzleOffsetKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.CharacterClass), GetTypeHash(Key.Mesh));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Gun));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Montage));
+		return HashCombine(Hash, GetTypeHash(Key.Frame));
+	}
+};
+
+/**
+ * Montage data that dedicated servers measure once and share between all characters of this world:
+ * gameplay event times from UGASAnimNotify_GameplayEvent and hero muzzle offsets per montage frame.
+ * Per world so every PIE session starts empty. In the editor, editing an animation or mesh empties it too.
+ */
+UCLASS()
+class GAS_API UGASMontageCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	// Montage's UGASAnimNotify_GameplayEvents sorted by time, gathered the first time it is asked for
+	const TArray<FGASMontageGameplayEvent>& GetMontageEvents(const UAnimMontage* Montage);
+
+	const FTransform* FindMuzzleOffset(const FGASMuzzleOffsetKey& Key) const;
+
+	void AddMuzzleOffset(const FGASMuzzleOffsetKey& Key, const FTransform& MuzzleOffset);
+
+	void Reset();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<FObjectKey, TArray<FGASMontageGameplayEvent>> MontageEvents;
+
+	// Relative to the actor
+	TMap<FGASMuzzleOffsetKey, FTransform> MuzzleOffsets;
+
+#if WITH_EDITOR
+	FDelegateHandle ObjectPropertyChangedHandle;
+
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& PropertyChangedEvent);
+#endif
+};
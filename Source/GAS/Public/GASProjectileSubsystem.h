@@ -0,0 +1,151 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/GASProjectile.h"
+#include "GameplayPrediction.h"
+#include "GASLagCompensationSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GASProjectileSubsystem.generated.h"
+
+class AGASCharacterMain;
+class UInstancedStaticMeshComponent;
+
+// Per projectile class data the simulation needs, read once from the class default object
+USTRUCT()
+struct FGASProjectileType
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AGASProjectile> ProjectileClass;
+
+	float Radius = 0.0f;
+
+	float GravityZ = 0.0f;
+
+	// From the class default object, spawns are only sent to clients viewing within this of the projectile's path
+	float NetCullDistanceSquared = 0.0f;
+
+	// Client and listen server only, draws every live projectile of this type
+	UPROPERTY()
+	UInstancedStaticMeshComponent* Instances = nullptr;
+};
+
+USTRUCT()
+struct FGASProjectileActorPool
+{
+	GENERATED_BODY()
+
+	// Inactive, dormant projectile actors ready to be reused
+	UPROPERTY()
+	TArray<AGASProjectile*> Projectiles;
+};
+
+/**
+ * Simulates projectiles without actors. State is kept in parallel arrays and advanced in one loop per frame,
+ * with the collision sweeps run in a ParallelFor when there are enough projectiles.
+ * The Server applies the damage spec on hit. Clients receive FGASProjectileSpawns through their AGASPlayerController
+ * and simulate the same flight for visuals only.
+ * On the Server, characters are hit where the instigating client saw them, through UGASLagCompensationSubsystem.
+ */
+UCLASS()
+class GAS_API UGASProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	// Server only. Starts simulating a projectile, check AGASProjectile::CanBeSimulated() first. Returns its ProjectileId.
+	// PredictionKey is the firing ability's activation prediction key, it lets the owning client match its predicted projectile.
+	uint32 FireProjectile(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, float Range, const FGameplayEffectSpecHandle& DamageEffectSpecHandle, AGASCharacterMain* Instigator, int16 PredictionKey = 0);
+
+	// Owning client only. Simulates a cosmetic projectile right away instead of waiting a round trip for the Server's.
+	// The Server's projectile with the same prediction key takes it over, it is removed if the activation is rejected.
+	void FirePredictedProjectile(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, float Range, AGASCharacterMain* Instigator, FPredictionKey PredictionKey);
+
+	// Client only. Simulates projectiles spawned on the Server.
+	void AddSimulatedProjectiles(const TArray<FGASProjectileSpawn>& Spawns);
+
+	int32 GetNumProjectiles() const;
+
+	// Server only. For projectiles that need an actor. Reuses a pooled AGASProjectile of ProjectileClass if there is one.
+	AGASProjectile* SpawnProjectileActor(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, float Range, const FGameplayEffectSpecHandle& DamageEffectSpecHandle, AActor* Owner, APawn* Instigator);
+
+	// Server only. Deactivates the projectile and keeps it for reuse, called when a pooled projectile is destroyed.
+	void ReleaseProjectileActor(AGASProjectile* Projectile);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY()
+	TArray<FGASProjectileType> Types;
+
+	// Projectile state, one entry per live projectile at the same index in every array
+	TArray<FVector> Locations;
+	TArray<FVector> Velocities;
+	TArray<float> RemainingRanges;
+	TArray<int32> TypeIndices;
+	TArray<uint32> ProjectileIds;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+	// Owning client only, prediction key of a predicted projectile that the Server's hasn't taken over yet. 0 otherwise.
+	TArray<int16> PredictionKeys;
+	// Server only, empty specs on clients
+	TArray<FGameplayEffectSpecHandle> DamageSpecs;
+	// Server only, how far back in time characters are traced for this projectile's instigator
+	TArray<float> RewindOffsets;
+
+	// Scratch results of the sweep pass
+	TArray<FHitResult> SweepHits;
+	TArray<bool> SweepBlocked;
+	TArray<FGASRewindHit> RewindHits;
+
+	// Spawns made this frame, sent at the start of next Tick()
+	UPROPERTY()
+	TArray<FGASProjectileSpawn> PendingSpawns;
+
+	// Scratch list of the spawns sent to one connection
+	TArray<FGASProjectileSpawn> ConnectionSpawns;
+
+	uint32 NextProjectileId = 1;
+
+	// Keys of recent predicted projectiles, so a Server projectile arriving after its prediction already hit something isn't shown again
+	TArray<int16> RecentPredictionKeys;
+	int32 NextRecentPredictionKey = 0;
+
+	UPROPERTY()
+	AActor* VisualsActor;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AGASProjectile>, FGASProjectileActorPool> ActorPools;
+
+	int32 FindOrAddType(TSubclassOf<AGASProjectile> ProjectileClass);
+
+	void AddProjectile(int32 TypeIndex, const FVector& Origin, const FVector& Velocity, float Range, uint32 ProjectileId, AActor* Instigator, const FGameplayEffectSpecHandle& DamageEffectSpecHandle, int16 PredictionKey = 0);
+
+	bool GetProjectileVelocity(TSubclassOf<AGASProjectile> ProjectileClass, const FTransform& SpawnTransform, FVector& OutVelocity) const;
+
+	// Moves the predicted projectile onto the Server projectile's path, keeping how far it has already flown. Returns false if there is none.
+	bool ReconcilePredictedProjectile(const FGASProjectileSpawn& Spawn, AGASCharacterMain* Instigator);
+
+	void OnPredictionKeyRejected(int16 PredictionKey);
+
+	void RemoveProjectileAt(int32 Index);
+
+	// Sends every client the spawns whose path passes within the projectile's net cull distance of its view.
+	// Through its player controller, which is always relevant to it, so neither the instigator's relevancy nor its update rate matter.
+	void SendPendingSpawns();
+
+	void SimulateProjectiles(float DeltaTime);
+
+	// Server only
+	void ApplyHit(int32 Index, const FHitResult& Hit);
+
+	void UpdateVisuals();
+};
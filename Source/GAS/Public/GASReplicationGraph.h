@@ -0,0 +1,110 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "GASReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+
+enum class EGASClassRepNodeMapping : uint32
+{
+	NotRouted,				// Doesn't go in any global node, e.g. PlayerControllers are only relevant to their owner
+	RelevantAllConnections,	// Always relevant to every connection
+	Spatialize_Static,		// Grid, doesn't move
+	Spatialize_Dynamic,		// Grid, moves every frame
+	Spatialize_Dormancy,	// Grid, moves while awake and can go net dormant, e.g. minions and pooled projectiles
+	CharacterFrequency,		// Never culled, replicated less often the further it is from the viewer
+};
+
+USTRUCT()
+struct FGASReplicationFrequencyBucket
+{
+	GENERATED_BODY()
+
+	// Characters closer than this to the nearest viewer use this bucket
+	UPROPERTY(Config)
+	float MaxDistance = 0.0f;
+
+	// The class replication period is multiplied by this
+	UPROPERTY(Config)
+	int32 PeriodMultiplier = 1;
+};
+
+/**
+ * Replicates heroes to every connection, less often the further they are from the connection's viewers.
+ * Characters are never culled by this node so distant heroes are still on the minimap, just updated less often.
+ */
+UCLASS()
+class GAS_API UGASReplicationGraphNode_CharacterFrequency : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+
+	virtual void NotifyResetAllNetworkActors() override;
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	// Sorted by MaxDistance. Characters further than the last bucket use its multiplier.
+	TArray<FGASReplicationFrequencyBucket> Buckets;
+
+protected:
+	FActorRepListRefView Characters;
+};
+
+/**
+ * Replication graph for this module, set as the IpNetDriver ReplicationDriverClassName in DefaultEngine.ini.
+ * Minions, projectiles and other moving actors are spatialized in a 2D grid so each connection only considers the cells around it.
+ * Heroes go through UGASReplicationGraphNode_CharacterFrequency. Game state and player states are relevant to everyone,
+ * a connection's own controller, pawn and view target are always relevant to that connection.
+ */
+UCLASS(Transient, Config = Engine)
+class GAS_API UGASReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	UGASReplicationGraph();
+
+	virtual void InitGlobalActorClassSettings() override;
+
+	virtual void InitGlobalGraphNodes() override;
+
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	UPROPERTY(Config)
+	float SpatialCellSize;
+
+	// Grid origin, should be below the smallest X and Y of the map to avoid growing the grid at runtime
+	UPROPERTY(Config)
+	FVector2D SpatialBias;
+
+	UPROPERTY(Config)
+	TArray<FGASReplicationFrequencyBucket> CharacterFrequencyBuckets;
+
+protected:
+	UPROPERTY()
+	UReplicationGraphNode_GridSpatialization2D* GridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
+
+	UPROPERTY()
+	UGASReplicationGraphNode_CharacterFrequency* CharacterFrequencyNode;
+
+	TClassMap<EGASClassRepNodeMapping> ClassRepNodePolicies;
+
+	EGASClassRepNodeMapping GetMappingPolicy(UClass* Class);
+
+	void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const;
+};
@@ -0,0 +1,24 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerStart.h"
+#include "GASSpawnPoint.generated.h"
+
+/**
+ * A PlayerStart that registers itself with the UGASSpawnPointSubsystem under its PlayerStartTag (team or role, e.g. "PlayerHero", "EnemyHero")
+ * so the GameMode can find it without scanning the world.
+ */
+UCLASS()
+class GAS_API AGASSpawnPoint : public APlayerStart
+{
+	GENERATED_BODY()
+
+public:
+	AGASSpawnPoint(const class FObjectInitializer& ObjectInitializer);
+
+	virtual void PostInitializeComponents() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
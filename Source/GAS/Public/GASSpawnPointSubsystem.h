@@ -0,0 +1,48 @@
+// Copyright 2020 Dan Kestranek.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GASSpawnPointSubsystem.generated.h"
+
+class AGASSpawnPoint;
+
+USTRUCT()
+struct FGASSpawnPointList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AGASSpawnPoint*> SpawnPoints;
+
+	// Round robin cursor so respawns are spread over all spawn points of a tag
+	int32 NextIndex = 0;
+};
+
+/**
+ * Registry of AGASSpawnPoints by their PlayerStartTag. Spawn points register themselves, lookups are a map find.
+ */
+UCLASS()
+class GAS_API UGASSpawnPointSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterSpawnPoint(AGASSpawnPoint* SpawnPoint);
+
+	void UnregisterSpawnPoint(AGASSpawnPoint* SpawnPoint);
+
+	// Returns the next spawn point for the tag, cycling through all of them. Null if none are registered.
+	UFUNCTION(BlueprintCallable, Category = "GAS|SpawnPoints")
+	AGASSpawnPoint* FindSpawnPoint(FName SpawnTag);
+
+	UFUNCTION(BlueprintCallable, Category = "GAS|SpawnPoints")
+	int32 GetNumSpawnPoints(FName SpawnTag) const;
+
+protected:
+	UPROPERTY()
+	TMap<FName, FGASSpawnPointList> SpawnPointsByTag;
+};
@@ -5,9 +5,34 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
 #include "Characters/GASCharacterMain.h"
+#include "Characters/GASProjectile.h"
 #include "UI/GASHUDWidget.h"
 #include "GASPlayerController.generated.h"
 
+// One floating damage number. Damage is sent rounded to 0.1.
+USTRUCT()
+struct FGASDamageNumber
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AGASCharacterMain* TargetCharacter = nullptr;
+
+	UPROPERTY()
+	float Damage = 0.0f;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASDamageNumber> : public TStructOpsTypeTraitsBase2<FGASDamageNumber>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 /**
  * 
  */
@@ -24,10 +49,24 @@ public:
 
 	class UGASHUDWidget* GetHUD();
 
-	UFUNCTION(Client, Reliable, WithValidation)
+	// Server only. Damage numbers are batched and sent to the client at the end of the frame in one unreliable RPC.
+	void QueueDamageNumber(float DamageAmount, AGASCharacterMain* TargetCharacter);
+
+	// Shows the floating damage number locally using a pooled damage text component
 	void ShowDamageNumber(float DamageAmount, AGASCharacterMain* TargetCharacter);
-	void ShowDamageNumber_Implementation(float DamageAmount, AGASCharacterMain* TargetCharacter);
-	bool ShowDamageNumber_Validate(float DamageAmount, AGASCharacterMain* TargetCharacter);
+
+	// Hides the damage text and returns it to the pool. Returns false if it isn't one of this pool's damage texts.
+	bool ReleaseDamageText(class UGASDamageTextWidgetComponent* DamageText);
+
+	// Damage numbers are cosmetic, losing a batch is fine
+	UFUNCTION(Client, Unreliable)
+	void ClientShowDamageNumbers(const TArray<FGASDamageNumber>& DamageNumbers);
+	void ClientShowDamageNumbers_Implementation(const TArray<FGASDamageNumber>& DamageNumbers);
+
+	// Simulated projectiles fired near this player last frame, see UGASProjectileSubsystem. Only simulated for visuals so losing some is fine.
+	UFUNCTION(Client, Unreliable)
+	void ClientProjectileSpawns(const TArray<FGASProjectileSpawn>& Spawns);
+	void ClientProjectileSpawns_Implementation(const TArray<FGASProjectileSpawn>& Spawns);
 
 	// Simple way to RPC to the client the countdown until they respawn from the GameMode. Will be latency amount of out sync with the Server.
 	UFUNCTION(Client, Reliable, WithValidation)
@@ -42,6 +81,36 @@ protected:
 	UPROPERTY(BlueprintReadWrite, Category = "GAS|UI")
 	class UGASHUDWidget* UIHUDWidget;
 
+	// Sum all damage to the same target in a frame into one damage number
+	UPROPERTY(EditAnywhere, Category = "GAS|UI")
+	bool bSumDamageNumbersPerTarget = true;
+
+	// Server only. Damage numbers queued this frame. A UPROPERTY so targets destroyed before the flush don't dangle.
+	UPROPERTY(Transient)
+	TArray<FGASDamageNumber> PendingDamageNumbers;
+
+	// Bound to FWorldDelegates::OnWorldPostActorTick while damage numbers are pending
+	FDelegateHandle DamageNumberFlushHandle;
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void FlushDamageNumbers();
+
+	// Max damage text components this player creates. When they are all in use the oldest one is recycled.
+	UPROPERTY(EditAnywhere, Category = "GAS|UI")
+	int32 DamageTextPoolSize = 32;
+
+	// Damage texts currently shown, oldest first
+	UPROPERTY()
+	TArray<class UGASDamageTextWidgetComponent*> ActiveDamageTexts;
+
+	UPROPERTY()
+	TArray<class UGASDamageTextWidgetComponent*> FreeDamageTexts;
+
+	class UGASDamageTextWidgetComponent* AcquireDamageText();
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Server only
 	virtual void OnPossess(APawn* InPawn) override;
 
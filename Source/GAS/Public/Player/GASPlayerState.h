@@ -24,6 +24,8 @@ public:
 
 	class UGASAttributeSetBase* GetAttributeSetBase() const;
 
+	class UGASAttributeSetEconomy* GetAttributeSetEconomy() const;
+
 	UFUNCTION(BlueprintCallable, Category = "GAS|GASPlayerState")
 	bool IsAlive() const;
 
@@ -32,7 +34,7 @@ public:
 
 
 	/**
-	* Getters for attributes from GASAttributeSetBase. Returns Current Value unless otherwise specified.
+	* Getters for attributes from GASAttributeSetBase and GASAttributeSetEconomy. Returns Current Value unless otherwise specified.
 	*/
 
 	UFUNCTION(BlueprintCallable, Category = "GAS|GASPlayerState|Attributes")
@@ -90,7 +92,9 @@ protected:
 	UPROPERTY()
 	class UGASAttributeSetBase* AttributeSetBase;
 
-	FGameplayTag DeadTag;
+	// XP, Gold and bounties. Only players have an economy, so this lives on the PlayerState and not on AGASCharacterMain.
+	UPROPERTY()
+	class UGASAttributeSetEconomy* AttributeSetEconomy;
 
 	FDelegateHandle HealthChangedDelegateHandle;
 	FDelegateHandle MaxHealthChangedDelegateHandle;
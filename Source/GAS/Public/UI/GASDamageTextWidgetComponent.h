@@ -8,6 +8,8 @@
 
 /**
  * For the floating Damage Numbers when a Character receives damage.
+ * Instances are pooled by the owning AGASPlayerController. They finish after Lifetime, or when the Blueprint calls FinishDamageText()
+ * or DestroyComponent, and go back to the pool instead of being destroyed.
  */
 UCLASS()
 class GAS_API UGASDamageTextWidgetComponent : public UWidgetComponent
@@ -17,4 +19,27 @@ class GAS_API UGASDamageTextWidgetComponent : public UWidgetComponent
 public:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable)
 	void SetDamageText(float Damage);
+
+	// Returns this damage text to its PlayerController's pool. Destroys it if it isn't pooled.
+	UFUNCTION(BlueprintCallable, Category = "GAS|UI")
+	void FinishDamageText();
+
+	// Called by the pool when this damage text is shown for a new hit
+	void ActivateDamageText(float Damage);
+
+	// Called by the pool when this damage text is hidden and returned
+	void DeactivateDamageText();
+
+	// Pooled damage texts are released to the pool instead, e.g. from the Blueprint DestroyComponent node
+	virtual void DestroyComponent(bool bPromoteChildren = false) override;
+
+protected:
+	// If > 0, the damage text is automatically finished after this many seconds. Should match the widget's animation length.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS|UI")
+	float Lifetime = 1.0f;
+
+	FTimerHandle LifetimeTimerHandle;
+
+	// Stops the widget animation and any pending Blueprint latent actions (Delay before DestroyComponent) of the last hit
+	void StopDamageTextAnimation();
 };